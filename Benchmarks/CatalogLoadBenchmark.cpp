@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CatalogLoadBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how long the memory-mapped catalog loader takes on a large
+// generated catalog against the getline and strtok path it replaced,
+// and how the parallel loader compares at several thread counts.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Storage/CatalogLoader.h"
+#include "../Storage/MappedFile.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text where every tenth ingredient is complex
+ * and every recipe uses five ingredients.
+ * @param numIngredients The number of ingredients.
+ * @param numRecipes The number of recipes.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients, int numRecipes){
+    string text = "BAR\nBenchmark Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        if (i % 10 == 9){
+            text += "complex,i" + to_string(i) + ",0.25,{i" + to_string(i - 1) + ",i" + to_string(i - 2) + "}\n";
+        } else {
+            text += "simple,i" + to_string(i) + ",0.50,100\n";
+        }
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < numRecipes; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{";
+        for (int j = 0; j < 5; j++){
+            text += "i" + to_string((i * 7 + j * 3) % numIngredients);
+            if (j < 4) text += ",";
+        }
+        text += "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Splits a line on commas the way the bar did before
+ * the memory-mapped loader.
+ * @param line The line to tokenize.
+ * @return A vector with all the string tokens.
+ */
+vector<string>* tokenize(string line){
+    vector<string>* tokens = new vector<string>();
+
+    char* cLine = new char[line.length() + 1];
+    strcpy(cLine, line.c_str());
+
+    char* current = strtok(cLine, ",");
+    while (current != NULL){
+        tokens->push_back(string(current));
+        current = strtok(NULL, ",");
+    }
+
+    delete[] cLine;
+    return tokens;
+}
+
+/**
+ * Strips the braces around a list item.
+ * @param item The item to strip.
+ * @return The item without braces.
+ */
+string stripBraces(string item){
+    if (!item.empty() && item[0] == '{') item.erase(0, 1);
+    if (!item.empty() && item[item.size() - 1] == '}') item.erase(item.size() - 1);
+    return item;
+}
+
+/**
+ * Adds an ingredient line the way the bar did before
+ * the memory-mapped loader.
+ * @param inventory The inventory to add to.
+ * @param line The line to add.
+ * @return Boolean indicating success.
+ */
+bool addIngredientLine(Inventory* inventory, const string& line){
+    vector<string>* tokens = tokenize(line);
+    bool success = false;
+
+    if (tokens->at(0).compare("simple") == 0 && tokens->size() == 4){
+        success = inventory->addSimpleIngredient(tokens->at(1), stoi(tokens->at(3)), stof(tokens->at(2)));
+    } else if (tokens->at(0).compare("complex") == 0 && tokens->size() >= 4 && !inventory->exists(tokens->at(1))){
+        vector<Ingredient*>* listOfIngredients = new vector<Ingredient*>();
+        success = true;
+        for (int i = 3; i < tokens->size() && success; i++){
+            Ingredient* current = inventory->getIngredient(stripBraces(tokens->at(i)));
+            if (current == NULL) success = false;
+            else listOfIngredients->push_back(current);
+        }
+
+        if (success) inventory->addComplexIngredient(tokens->at(1), stof(tokens->at(2)), listOfIngredients);
+        else delete listOfIngredients;
+    }
+
+    delete tokens;
+    return success;
+}
+
+/**
+ * Adds a simple recipe line the way the bar did before
+ * the memory-mapped loader.
+ * @param inventory The inventory holding the ingredients.
+ * @param recipes The catalog to add to.
+ * @param line The line to add.
+ * @return Boolean indicating success.
+ */
+bool addRecipeLine(Inventory* inventory, RecipeCatalog* recipes, const string& line){
+    vector<string>* tokens = tokenize(line);
+    if (tokens->size() < 4 || tokens->at(0).compare("simple") != 0 || recipes->exists(tokens->at(1))){
+        delete tokens;
+        return false;
+    }
+
+    vector<Ingredient*> recipeIngredients;
+    for (int i = 3; i < tokens->size(); i++){
+        Ingredient* current = inventory->getIngredient(stripBraces(tokens->at(i)));
+        if (current == NULL){
+            delete tokens;
+            return false;
+        }
+        recipeIngredients.push_back(current);
+    }
+
+    recipes->addRecipe(new Recipe(tokens->at(1), recipeIngredients, stof(tokens->at(2)),
+                                  inventory->getIndex()));
+    delete tokens;
+    return true;
+}
+
+/**
+ * Loads a catalog file line by line with getline, the
+ * way the bar did before the memory-mapped loader.
+ * @param filename The catalog file.
+ * @param inventory The inventory to fill.
+ * @param recipes The recipe catalog to fill.
+ * @return Boolean indicating success.
+ */
+bool loadWithGetline(const string& filename, Inventory* inventory, RecipeCatalog* recipes){
+    ifstream loadStream(filename.c_str());
+    if (!loadStream.is_open()) return false;
+
+    string line;
+    int section = 0;
+    while (getline(loadStream, line)){
+        if (line.empty() || line.compare(0, 2, "//") == 0) continue;
+
+        if (line.compare("BAR") == 0) section = 1;
+        else if (line.compare("INGREDIENT") == 0) section = 2;
+        else if (line.compare("RECIPE") == 0) section = 3;
+        else if (section == 1) delete tokenize(line);
+        else if (section == 2 && !addIngredientLine(inventory, line)) return false;
+        else if (section == 3 && !addRecipeLine(inventory, recipes, line)) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Loads a catalog file through the memory-mapped loader.
+ * @param filename The catalog file.
+ * @param inventory The inventory to fill.
+ * @param recipes The recipe catalog to fill.
+ * @param numThreads The threads of the parallel loader or 0 for the sequential one.
+ * @return Boolean indicating success.
+ */
+bool loadMapped(const string& filename, Inventory* inventory, RecipeCatalog* recipes, int numThreads){
+    MappedFile file;
+    if (!file.open(filename)) return false;
+
+    CatalogLoader loader(inventory, recipes);
+    string msg;
+    if (numThreads == 0) return loader.load(file.getData(), file.getSize(), &msg);
+    return loader.loadParallel(file.getData(), file.getSize(), numThreads, &msg);
+}
+
+/**
+ * Times one loader on a fresh inventory and catalog.
+ * @param filename The catalog file.
+ * @param numThreads -1 for getline, 0 for the sequential loader
+ *                   or the threads of the parallel loader.
+ * @param seconds Gets the time taken.
+ * @return Boolean indicating success.
+ */
+bool measure(const string& filename, int numThreads, double* seconds){
+    Inventory inventory;
+    RecipeCatalog recipes;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    bool success = numThreads < 0 ? loadWithGetline(filename, &inventory, &recipes)
+                                  : loadMapped(filename, &inventory, &recipes, numThreads);
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    *seconds = elapsed.count();
+    return success;
+}
+
+/**
+ * Runs the benchmark.
+ * @param argc The number of arguments.
+ * @param argv The number of ingredients and recipes and the catalog file can be given.
+ * @return Program return code.
+ */
+int main(int argc, char** argv){
+    int numItems = 100000;
+    if (argc > 1){
+        try {
+            numItems = stoi(argv[1]);
+        } catch (...) {
+            numItems = 0;
+        }
+    }
+    if (numItems < 10){
+        cout << "Usage: CatalogLoadBenchmark [ingredients and recipes] [catalog file]" << endl;
+        return 1;
+    }
+    string filename = argc > 2 ? argv[2] : "CatalogLoadBenchmark.txt";
+
+    string catalog = buildCatalog(numItems, numItems);
+    ofstream out(filename.c_str(), ios::binary);
+    out << catalog;
+    out.close();
+    if (!out){
+        cout << "Could not write " << filename << "." << endl;
+        return 1;
+    }
+
+    cout << numItems << " ingredients and " << numItems << " recipes, "
+         << catalog.size() / 1024 << " KB" << endl;
+
+    double seconds;
+    bool success = measure(filename, -1, &seconds);
+    if (success) cout << "getline and strtok: " << fixed << setprecision(1) << seconds * 1000 << " ms" << endl;
+    success = success && measure(filename, 0, &seconds);
+    if (success) cout << "Memory-mapped: " << fixed << setprecision(1) << seconds * 1000 << " ms" << endl;
+
+    int threadCounts[] = {1, 2, 4, 8};
+    for (int i = 0; i < 4 && success; i++){
+        success = measure(filename, threadCounts[i], &seconds);
+        if (success) cout << "Parallel, " << threadCounts[i] << " threads: " << seconds * 1000 << " ms" << endl;
+    }
+
+    remove(filename.c_str());
+    if (!success){
+        cout << "The catalog failed to load." << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// InventoryLoadBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how long it takes to load catalogs of 10,000 and 100,000
+// ingredients into an inventory and to remove every ingredient again.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text where every tenth ingredient is
+ * complex and made from the two simple ones before it.
+ * @param numIngredients The number of ingredients.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients){
+    string text = "BAR\nBenchmark Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        if (i % 10 == 9){
+            text += "complex,i" + to_string(i) + ",0.25,{i" + to_string(i - 1) + ",i" + to_string(i - 2) + "}\n";
+        } else {
+            text += "simple,i" + to_string(i) + ",0.50,100\n";
+        }
+    }
+
+    return text;
+}
+
+/**
+ * Loads a catalog into a fresh inventory then removes
+ * every ingredient by name in a shuffled order.
+ * @param numIngredients The number of ingredients.
+ * @return Boolean indicating success.
+ */
+bool measure(int numIngredients){
+    string catalog = buildCatalog(numIngredients);
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+
+    string msg;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << msg << endl;
+        return false;
+    }
+    chrono::duration<double> loadTime = chrono::steady_clock::now() - start;
+
+    //Every run removes in the same order.
+    vector<string> names;
+    for (int i = 0; i < numIngredients; i++){
+        names.push_back("i" + to_string(i));
+    }
+    mt19937 engine(42);
+    shuffle(names.begin(), names.end(), engine);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < names.size(); i++){
+        inventory.removeIngredient(inventory.getIngredient(names[i]));
+    }
+    chrono::duration<double> removeTime = chrono::steady_clock::now() - start;
+
+    if (inventory.getInventorySize() != 0){
+        cout << "Not every ingredient was removed." << endl;
+        return false;
+    }
+
+    cout << numIngredients << " ingredients: load " << fixed << setprecision(3)
+         << loadTime.count() * 1000 << " ms, remove all " << removeTime.count() * 1000 << " ms" << endl;
+    return true;
+}
+
+/**
+ * Runs the benchmark.
+ * @return Program return code.
+ */
+int main(){
+    if (!measure(10000) || !measure(100000)) return 1;
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// JournalBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how many orders per second the journal logs without fsync and
+// with an fsync every 1, 10, 100 and 1000 records, and how fast a journal
+// is read back on recovery.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Simulation/OrderGenerator.h"
+#include "../Storage/CatalogLoader.h"
+#include "../Storage/Journal.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text for the orders being logged.
+ * @param numIngredients The number of simple ingredients.
+ * @param numRecipes The number of recipes.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients, int numRecipes){
+    string text = "BAR\nBenchmark Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        text += "simple,i" + to_string(i) + ",0.50,100000000\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < numRecipes; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{";
+        for (int j = 0; j < 5; j++){
+            text += "i" + to_string((i * 7 + j * 3) % numIngredients);
+            if (j < 4) text += ",";
+        }
+        text += "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Logs every bill to a new journal and times it,
+ * including the final flush.
+ * @param filename The journal file.
+ * @param bills The bills to log.
+ * @param syncInterval The records per fsync or 0 to never sync.
+ * @return The orders logged per second.
+ */
+double measureLog(const string& filename, const vector<BillOfMaterials>& bills, int syncInterval){
+    remove(filename.c_str());
+
+    Journal journal;
+    string msg;
+    if (!journal.open(filename, 0, &msg)){
+        cout << msg << endl;
+        return 0;
+    }
+    journal.setSyncInterval(syncInterval);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < bills.size(); i++){
+        journal.logOrder(bills[i], 10.0);
+    }
+    journal.flush();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    return bills.size() / elapsed.count();
+}
+
+/**
+ * Opens a journal, reads back every order in it and
+ * times it.
+ * @param filename The journal file.
+ * @param numOrders The number of orders expected.
+ * @return The orders read per second.
+ */
+double measureReplay(const string& filename, int numOrders){
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    Journal journal;
+    string msg;
+    if (!journal.open(filename, 0, &msg)){
+        cout << msg << endl;
+        return 0;
+    }
+
+    JournalEntry entry;
+    vector<BillItem> items;
+    float amount;
+    int read = 0;
+    while (journal.next(entry)){
+        if (Journal::readItems(entry, amount, items)) read++;
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    if (read != numOrders) cout << "Only " << read << " of " << numOrders << " orders were read back." << endl;
+    return read / elapsed.count();
+}
+
+/**
+ * Runs the benchmark.
+ * @param argc The number of arguments.
+ * @param argv The number of orders and the journal file can be given.
+ * @return Program return code.
+ */
+int main(int argc, char** argv){
+    int numOrders = 20000;
+    if (argc > 1){
+        try {
+            numOrders = stoi(argv[1]);
+        } catch (...) {
+            numOrders = 0;
+        }
+    }
+    if (numOrders < 1){
+        cout << "Usage: JournalBenchmark [orders] [journal file]" << endl;
+        return 1;
+    }
+    string filename = argc > 2 ? argv[2] : "JournalBenchmark.journal";
+
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+    string catalog = buildCatalog(50, 20);
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << msg << endl;
+        return 1;
+    }
+
+    //Every run logs the same bills.
+    OrderGenerator generator(&recipes, &inventory, 42);
+    vector<BillOfMaterials> bills(numOrders);
+    for (int i = 0; i < numOrders; i++){
+        Order* order = generator.generateOrder();
+        order->appendBill(bills[i]);
+        bills[i].compact();
+        delete order;
+    }
+
+    cout << "Orders per run: " << numOrders << endl;
+    int syncIntervals[] = {0, 1000, 100, 10, 1};
+    for (int i = 0; i < 5; i++){
+        double rate = measureLog(filename, bills, syncIntervals[i]);
+        if (syncIntervals[i] == 0) cout << "No fsync";
+        else cout << syncIntervals[i] << " records per fsync";
+
+        cout << ": " << fixed << setprecision(0) << rate << " orders/sec" << endl;
+    }
+
+    double rate = measureReplay(filename, numOrders);
+    cout << "Read back: " << fixed << setprecision(0) << rate << " orders/sec" << endl;
+
+    remove(filename.c_str());
+    return 0;
+}
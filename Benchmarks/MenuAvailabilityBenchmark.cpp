@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MenuAvailabilityBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how many whole-menu availability checks per second the
+// requirement matrix runs against calling canMake on every recipe.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Capital/MenuAvailability.h"
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text where some ingredients are out of
+ * stock so only part of the menu can be made.
+ * @param numIngredients The number of simple ingredients.
+ * @param numRecipes The number of recipes.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients, int numRecipes){
+    string text = "BAR\nBenchmark Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        text += "simple,i" + to_string(i) + ",0.50," + (i % 13 == 0 ? "0" : "100") + "\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < numRecipes; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{";
+        for (int j = 0; j < 8; j++){
+            text += "i" + to_string((i * 7 + j * 31) % numIngredients);
+            if (j < 7) text += ",";
+        }
+        text += "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Checks the whole menu by calling canMake on every recipe.
+ * @param recipes The recipe catalog.
+ * @param bitmap The bitmap to fill in.
+ */
+void checkEach(RecipeCatalog& recipes, vector<unsigned int>& bitmap){
+    bitmap.assign((recipes.getSize() + 31) / 32, 0);
+    for (int i = 0; i < recipes.getSize(); i++){
+        if (recipes.getRecipe(i)->canMake()) bitmap[i / 32] |= 1u << (i % 32);
+    }
+}
+
+/**
+ * Runs the benchmark.
+ * @param argc The number of arguments.
+ * @param argv The number of checks per run can be given.
+ * @return Program return code.
+ */
+int main(int argc, char** argv){
+    int numChecks = 2000;
+    if (argc > 1){
+        try {
+            numChecks = stoi(argv[1]);
+        } catch (...) {
+            numChecks = 0;
+        }
+    }
+    if (numChecks < 1){
+        cout << "Usage: MenuAvailabilityBenchmark [checks]" << endl;
+        return 1;
+    }
+
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+    string catalog = buildCatalog(500, 2000);
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << msg << endl;
+        return 1;
+    }
+
+    MenuAvailability availability;
+    availability.build(&recipes, inventory.getIndex());
+
+    //Both checks have to agree before they are timed.
+    vector<unsigned int> expected;
+    vector<unsigned int> bitmap;
+    checkEach(recipes, expected);
+    availability.check(*inventory.getStockTable(), bitmap);
+    if (bitmap != expected){
+        cout << "The matrix and canMake disagree." << endl;
+        return 1;
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < numChecks; i++){
+        checkEach(recipes, bitmap);
+    }
+    chrono::duration<double> eachTime = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < numChecks; i++){
+        availability.check(*inventory.getStockTable(), bitmap);
+    }
+    chrono::duration<double> matrixTime = chrono::steady_clock::now() - start;
+
+    cout << "Menu of " << recipes.getSize() << " recipes, " << numChecks << " checks" << endl;
+    cout << "canMake per recipe: " << fixed << setprecision(0) << numChecks / eachTime.count() << " checks/sec" << endl;
+    cout << "Requirement matrix: " << numChecks / matrixTime.count() << " checks/sec" << endl;
+
+    return 0;
+}
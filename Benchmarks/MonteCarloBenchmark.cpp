@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MonteCarloBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how the Monte Carlo driver scales by running the same
+// replicas on 1, 2, 4, 8 and 16 threads.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../Simulation/MonteCarlo.h"
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text with enough stock that replicas
+ * run out of some ingredients but rarely go bankrupt.
+ * @param numIngredients The number of simple ingredients.
+ * @param numRecipes The number of recipes.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients, int numRecipes){
+    string text = "BAR\nBenchmark Bar,100000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        text += "simple,i" + to_string(i) + ",0.50,5000\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < numRecipes; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{";
+        for (int j = 0; j < 5; j++){
+            text += "i" + to_string((i * 7 + j * 3) % numIngredients);
+            if (j < 4) text += ",";
+        }
+        text += "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Runs the benchmark.
+ * @param argc The number of arguments.
+ * @param argv The number of replicas and orders per replica can be given.
+ * @return Program return code.
+ */
+int main(int argc, char** argv){
+    int numReplicas = 64;
+    long long numOrders = 20000;
+    try {
+        if (argc > 1) numReplicas = stoi(argv[1]);
+        if (argc > 2) numOrders = stoll(argv[2]);
+    } catch (...) {
+        numReplicas = 0;
+    }
+    if (numReplicas < 1 || numOrders < 1){
+        cout << "Usage: MonteCarloBenchmark [replicas] [orders per replica]" << endl;
+        return 1;
+    }
+
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+    string catalog = buildCatalog(50, 20);
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << msg << endl;
+        return 1;
+    }
+
+    //Every thread count runs the same replicas.
+    SimulationSettings settings;
+    settings.numOrders = numOrders;
+    settings.seed = 42;
+    settings.popularity = 0;
+    settings.substitutionRate = 0.5;
+    settings.maxSandwiches = 10;
+    settings.maxSubstitutions = 2;
+    settings.verbose = false;
+
+    cout << numReplicas << " replicas of " << numOrders << " orders, "
+         << thread::hardware_concurrency() << " cores" << endl;
+
+    int threadCounts[] = {1, 2, 4, 8, 16};
+    double baseline = 0;
+    double revenue = 0;
+    for (int i = 0; i < 5; i++){
+        MonteCarlo driver(&inventory, &recipes, loader.getFunds());
+        MonteCarloStats stats = driver.run(settings, numReplicas, threadCounts[i]);
+
+        //The results must not depend on the thread count.
+        if (i == 0){
+            baseline = stats.seconds;
+            revenue = stats.revenueP50;
+        } else if (stats.revenueP50 != revenue){
+            cout << "Results changed with " << threadCounts[i] << " threads." << endl;
+            return 1;
+        }
+
+        cout << stats.threads << " threads: " << fixed << setprecision(1)
+             << numReplicas / stats.seconds << " replicas/sec, "
+             << setprecision(2) << baseline / stats.seconds << "x" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderEngineBenchmark.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Measures how many orders per second the order engine reserves with
+// 1, 2, 4, 8 and 16 workers against reserving them on one thread.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Customers/OrderEngine.h"
+#include "../Simulation/OrderGenerator.h"
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/**
+ * Builds catalog text with plenty of stock so no
+ * order runs out while being measured.
+ * @param numIngredients The number of simple ingredients.
+ * @param numRecipes The number of recipes.
+ * @return The catalog text.
+ */
+string buildCatalog(int numIngredients, int numRecipes){
+    string text = "BAR\nBenchmark Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < numIngredients; i++){
+        text += "simple,i" + to_string(i) + ",0.50,100000000\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < numRecipes; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{";
+        for (int j = 0; j < 5; j++){
+            text += "i" + to_string((i * 7 + j * 3) % numIngredients);
+            if (j < 4) text += ",";
+        }
+        text += "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Reserves a batch of orders on a fresh bar and times it.
+ * @param catalog The catalog text.
+ * @param numOrders The number of orders.
+ * @param numWorkers The number of engine workers or 0 to reserve on this thread.
+ * @return The orders reserved per second.
+ */
+double measure(const string& catalog, int numOrders, int numWorkers){
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << msg << endl;
+        return 0;
+    }
+
+    //Every run reserves the same orders.
+    OrderGenerator generator(&recipes, &inventory, 42);
+    vector<Order*> orders;
+    for (int i = 0; i < numOrders; i++){
+        orders.push_back(generator.generateOrder());
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (numWorkers == 0){
+        for (int i = 0; i < numOrders; i++){
+            inventory.reserve(orders[i]);
+        }
+    } else {
+        OrderEngine engine(&inventory, &recipes, numWorkers);
+        for (int i = 0; i < numOrders; i++){
+            engine.submit(orders[i]);
+        }
+        engine.drain();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    for (int i = 0; i < numOrders; i++){
+        delete orders[i];
+    }
+
+    return numOrders / elapsed.count();
+}
+
+/**
+ * Runs the benchmark.
+ * @param argc The number of arguments.
+ * @param argv The number of orders per run can be given.
+ * @return Program return code.
+ */
+int main(int argc, char** argv){
+    int numOrders = 200000;
+    if (argc > 1){
+        try {
+            numOrders = stoi(argv[1]);
+        } catch (...) {
+            numOrders = 0;
+        }
+    }
+    if (numOrders < 1){
+        cout << "Usage: OrderEngineBenchmark [orders]" << endl;
+        return 1;
+    }
+
+    string catalog = buildCatalog(50, 20);
+    int workerCounts[] = {0, 1, 2, 4, 8, 16};
+
+    cout << "Orders per run: " << numOrders << endl;
+    for (int i = 0; i < 6; i++){
+        double rate = measure(catalog, numOrders, workerCounts[i]);
+        if (workerCounts[i] == 0) cout << "Single thread";
+        else cout << workerCounts[i] << " workers";
+
+        cout << ": " << fixed << setprecision(0) << rate << " orders/sec" << endl;
+    }
+
+    return 0;
+}
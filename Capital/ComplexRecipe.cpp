@@ -21,15 +21,20 @@ using namespace std;
  * @param base The base recipe.
  * @param removed The ingredients to remove.
  * @param premium The recipe premium.
+ * @param index The reference index of the bar.
  */
 ComplexRecipe::ComplexRecipe(string name, vector<Ingredient*> ings,
-        Recipe* base, vector<Ingredient*> removed, float premium) : Recipe(name, ings, premium){
+        Recipe* base, vector<Ingredient*> removed, float premium, ReferenceIndex* index)
+        : Recipe(name, ings, premium, index){
     //Sets the base recipe and the removed items.
     baseRecipe = base;
     removedIngredients = removed;
 
-    //Manages the references.
-    manageReferences();
+    //The base recipe covers the rest of the references.
+    addReference(base);
+
+    //The structure never changes so the ingredient list is built once.
+    mergeIngredients();
 }
 
 /**
@@ -38,20 +43,11 @@ ComplexRecipe::ComplexRecipe(string name, vector<Ingredient*> ings,
 ComplexRecipe::~ComplexRecipe(){ }
 
 /**
- * Gets the total cost of the recipe.
- * Includes the premium.
- * @return The total recipe cost.
- */
-float ComplexRecipe::getTotalCost(){
-    return getRawCost() + premium;
-}
-
-/**
- * Gets the cost of the recipe.
- * Only ingredient cost.
+ * Computes the cost of the recipe from the
+ * base recipe, additions and removals.
  * @return The raw cost of the recipe.
  */
-float ComplexRecipe::getRawCost(){
+float ComplexRecipe::computeRawCost(){
     float cost = 0;
 
     //First, get the base cost.
@@ -64,67 +60,20 @@ float ComplexRecipe::getRawCost(){
 }
 
 /**
- * Indicates whether the recipe can be made.
- * @return A boolean indicating whether the recipe can be made.
- */
-bool ComplexRecipe::canMake(){
-    //Check if we can make the base recipe.
-    if (!baseRecipe->canMake(removedIngredients)) return false;
-
-    //Next, we check if we can make the added ingredients.
-    return canMakeIngredients();
-}
-
-/**
- * Makes the recipe by using the inventory.
- * @return Whether the recipe was made.
+ * Adds the simple ingredients needed for this recipe
+ * to a bill of materials. The base recipe skips our own
+ * removals as well as the ones passed in, which are
+ * chained on rather than copied.
+ * @param removed The removed ingredients.
+ * @param bill The bill to add to.
  */
-bool ComplexRecipe::make(){
-    //Check if we can make it.
-    if (!canMake()) return false;
-
-    //Now, we make the recipe.
-    baseRecipe->make(removedIngredients);
-    makeIngredients();
-
-    return true;
-}
-
-/**
- * Indicates whether the recipe can be made.
- * Ignores removed ingredients.
- * @param removed A vector of ingredients to be removed.
- * @return Boolean indicating whether it can be made.
- */
-bool ComplexRecipe::canMake(std::vector<Ingredient*> removed){
-    //Merge the removed with removals.
-    vector<Ingredient*> removeList = mergeRemovals(removed);
-
-    //Check if we can make.
-    if (!baseRecipe->canMake(removeList)) return false;
-
-    //Next, we check if we can make the added ingredients.
-    return canMakeIngredients(removed);
-}
-
-/**
- * Makes the recipe.
- * Ignores removed ingredients.
- * @param removed A vector of removed ingredients.
- * @return Boolean indicating success of it being made.
- */
-bool ComplexRecipe::make(std::vector<Ingredient*> removed){
-    //Check if we can make it.
-    if (!canMake(removed)) return false;
-
-    //Merge the removed with removals.
-    vector<Ingredient*> removeList = mergeRemovals(removed);
+void ComplexRecipe::appendBill(IngredientSpan removed, BillOfMaterials& bill){
+    IngredientSpan removeList(removedIngredients);
+    if (!removed.empty()) removeList.next = &removed;
+    baseRecipe->appendBill(removeList, bill);
 
-    //Now, we make the recipe.
-    baseRecipe->make(removeList);
-    makeIngredients(removed);
-
-    return true;
+    //Next, we add the added ingredients.
+    appendIngredients(removed, bill);
 }
 
 /**
@@ -151,7 +100,7 @@ string ComplexRecipe::printDetails(){
     text += "\t- Uses: {";
 
     //Gets the ingredients.
-    vector<Ingredient*> ings = getIngredients();
+    const vector<Ingredient*>& ings = getIngredients();
     for (int i = 0; i < ings.size(); i++){
         text += ings.at(i)->getName();
         if (i + 1 < ings.size()){
@@ -171,10 +120,18 @@ string ComplexRecipe::printDetails(){
  * Gets all ingredients in the recipe.
  * @return A vector of ingredients in the recipe.
  */
-vector<Ingredient*> ComplexRecipe::getIngredients() {
+const vector<Ingredient*>& ComplexRecipe::getIngredients() {
+    return mergedIngredients;
+}
+
+/**
+ * Builds the list of ingredients in the recipe from
+ * the base recipe, additions and removals.
+ */
+void ComplexRecipe::mergeIngredients() {
     //Creates an updated list of ingredients.
-    vector<Ingredient*> concatList = vector<Ingredient*>();
-    vector<Ingredient*> baseIngredients = baseRecipe->getIngredients();
+    vector<Ingredient*>& concatList = mergedIngredients;
+    const vector<Ingredient*>& baseIngredients = baseRecipe->getIngredients();
     vector<Ingredient*> addedIngredients = getSubComponents();
 
     //Now, merges all the lists together.
@@ -196,8 +153,22 @@ vector<Ingredient*> ComplexRecipe::getIngredients() {
             }
         }
     }
+}
 
-    return concatList;
+/**
+ * Gets the recipe this recipe is based on.
+ * @return The base recipe.
+ */
+Recipe* ComplexRecipe::getBaseRecipe(){
+    return baseRecipe;
+}
+
+/**
+ * Gets the ingredients removed from the base recipe.
+ * @return The removed ingredients.
+ */
+const vector<Ingredient*>& ComplexRecipe::getRemovedIngredients(){
+    return removedIngredients;
 }
 
 /**
@@ -215,23 +186,6 @@ bool ComplexRecipe::containsIngredient(string ingName){
     return false;
 }
 
-void ComplexRecipe::updateReferences(std::vector<Food*> references){
-    //We first pass the references to ourselves.
-    addReferences(references);
-
-    //We now add ourselves.
-    references.push_back(this);
-
-    //We now call the base recipe.
-    baseRecipe->updateReferences(references);
-
-    //Finally, we call our ingredients.
-    vector<Ingredient*> listOfIngredients = getSubComponents();
-    for (int i = 0; i < listOfIngredients.size(); i++){
-        listOfIngredients.at(i)->updateReferences(references);
-    }
-}
-
 /**
  * Checks whether an item has been removed.
  * Goes through the removal list based on a name.
@@ -247,18 +201,4 @@ bool ComplexRecipe::findRemoval(string ingName){
     }
 
     return false;
-}
-
-/**
- * Takes two vectors and merges them into one.
- * Does this to amalgamate removal lists.
- * @param removeOne Vector of removed items.
- * @return Combined vector.
- */
-vector<Ingredient*> ComplexRecipe::mergeRemovals(vector<Ingredient*> removeOne){
-    vector<Ingredient*> removeList = vector<Ingredient*>();
-    removeList.insert(removeList.end(), removeOne.begin(), removeOne.end());
-    removeList.insert(removeList.end(), removedIngredients.begin(), removedIngredients.end());
-
-    return removeList;
 }
\ No newline at end of file
@@ -18,37 +18,37 @@ class ComplexRecipe : public Recipe {
 public:
     /** Constructors/Destructors */
     ComplexRecipe(std::string name, std::vector<Ingredient*> ings,
-            Recipe* base, std::vector<Ingredient*> removed, float premium);
+            Recipe* base, std::vector<Ingredient*> removed, float premium, ReferenceIndex* index);
     ~ComplexRecipe();
 
-    /** Cost Methods */
-    float getTotalCost();
-    float getRawCost();
-
-    /** Make Methods */
-    bool canMake();
-    bool make();
-    bool canMake(std::vector<Ingredient*> removed);
-    bool make(std::vector<Ingredient*> removed);
+    /** Bill Methods */
+    void appendBill(IngredientSpan removed, BillOfMaterials& bill);
 
     /** Print Methods */
     std::string print();
     std::string printDetails();
 
     /** Ingredient Methods */
-    std::vector<Ingredient*> getIngredients();
+    const std::vector<Ingredient*>& getIngredients();
     bool containsIngredient(std::string ingName);
 
-    /** Update Method */
-    void updateReferences(std::vector<Food*> references);
+    /** Structure Methods */
+    Recipe* getBaseRecipe();
+    const std::vector<Ingredient*>& getRemovedIngredients();
+
+protected:
+    /** Helper Methods */
+    float computeRawCost();
+
 private:
     /** Private Variables */
     Recipe* baseRecipe;
     std::vector<Ingredient*> removedIngredients;
+    std::vector<Ingredient*> mergedIngredients;
 
     /** Helper Methods */
     bool findRemoval(std::string ingName);
-    std::vector<Ingredient*> mergeRemovals(std::vector<Ingredient*> removeOne);
+    void mergeIngredients();
 };
 
 
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// DemandHistory.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Records how much of each simple ingredient committed orders use. Usage
+// is kept per bucket of orders in a small ring for every stock slot and
+// gives moving average and exponentially smoothed forecasts in O(1).
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "DemandHistory.h"
+
+using namespace std;
+
+/**
+ * Creates an empty history for a stock table. Every slot
+ * keeps the open bucket plus a window of closed ones.
+ * @param table The stock table being used.
+ * @param numBuckets The closed buckets the moving average covers.
+ * @param ordersPerBucket The number of orders in a bucket.
+ * @param smoothing The weight of the newest bucket, clamped above 0 and at most 1.
+ */
+DemandHistory::DemandHistory(StockTable* table, int numBuckets, int ordersPerBucket, float smoothing){
+    this->table = table;
+    width = (numBuckets < 1 ? 1 : numBuckets) + 1;
+    this->ordersPerBucket = (ordersPerBucket < 1 ? 1 : ordersPerBucket);
+    orders = 0;
+    bucket = 0;
+
+    //A weight of 0 never forgets and divides by zero when corrected.
+    if (!(smoothing > 0)) this->smoothing = 0.01;
+    else this->smoothing = (smoothing > 1 ? 1 : smoothing);
+}
+
+/**
+ * Default destructor. The stock table is not owned.
+ */
+DemandHistory::~DemandHistory(){ }
+
+/**
+ * Records a committed order. Only the slots in the bill
+ * are touched so this is cheap enough for every order.
+ * @param bill The compacted bill of the order.
+ */
+void DemandHistory::record(const BillOfMaterials& bill){
+    grow();
+
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        int slot = items[i].slot;
+        roll(slot);
+        counts[slot * width + bucket % width] += items[i].count;
+    }
+
+    //The clock only moves in whole orders.
+    orders++;
+    bucket = orders / ordersPerBucket;
+}
+
+/**
+ * Gets the number of orders recorded.
+ * @return The number of orders.
+ */
+long long DemandHistory::getOrders(){
+    return orders;
+}
+
+/**
+ * Gets the bucket orders are being recorded in.
+ * @return The open bucket.
+ */
+long long DemandHistory::getBucket(){
+    return bucket;
+}
+
+/**
+ * Gets the average use of a slot over the closed buckets
+ * in the window. Early on only the buckets so far count.
+ * @param slot The slot of the simple ingredient.
+ * @return The average use per bucket.
+ */
+float DemandHistory::getMovingAverage(int slot){
+    long long closed = (bucket < width - 1 ? bucket : width - 1);
+    if (closed == 0 || slot < 0 || slot >= table->getSize()) return 0;
+
+    grow();
+    roll(slot);
+    return (float) windowSums[slot] / closed;
+}
+
+/**
+ * Gets the exponentially smoothed use of a slot per
+ * bucket. Corrected for starting at zero.
+ * @param slot The slot of the simple ingredient.
+ * @return The smoothed use per bucket.
+ */
+float DemandHistory::getSmoothed(int slot){
+    if (bucket == 0 || slot < 0 || slot >= table->getSize()) return 0;
+
+    grow();
+    roll(slot);
+    return smoothed[slot] / (1 - pow(1 - smoothing, (double) bucket));
+}
+
+/**
+ * Gets the number of orders in a bucket.
+ * @return The orders per bucket.
+ */
+int DemandHistory::getOrdersPerBucket(){
+    return ordersPerBucket;
+}
+
+/**
+ * Makes sure every slot in the table has a history.
+ * New slots start with no use up to the open bucket.
+ */
+void DemandHistory::grow(){
+    int size = table->getSize();
+    if (lastBuckets.size() >= size) return;
+
+    counts.resize((size_t) size * width, 0);
+    windowSums.resize(size, 0);
+    smoothed.resize(size, 0);
+    lastBuckets.resize(size, bucket);
+}
+
+/**
+ * Brings a slot up to the open bucket. Each bucket that
+ * closed since the slot was last used enters the window
+ * and the smoothed value, and the oldest one leaves.
+ * Idle stretches are skipped in one step.
+ * @param slot The slot to bring up to date.
+ */
+void DemandHistory::roll(int slot){
+    long long last = lastBuckets[slot];
+    if (last == bucket) return;
+    int* ring = &counts[(size_t) slot * width];
+
+    //Only the first bucket to close can hold any use.
+    int used = ring[last % width];
+    smoothed[slot] = smoothing * used + (1 - smoothing) * smoothed[slot];
+    smoothed[slot] *= pow(1 - smoothing, (double) (bucket - last - 1));
+
+    //After a full turn of the ring every bucket is cleared.
+    for (long long i = last; i < bucket && i < last + width; i++){
+        int next = (i + 1) % width;
+        windowSums[slot] += ring[i % width] - ring[next];
+        ring[next] = 0;
+    }
+    lastBuckets[slot] = bucket;
+}
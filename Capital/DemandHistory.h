@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// DemandHistory.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Records how much of each simple ingredient committed orders use. Usage
+// is kept per bucket of orders in a small ring for every stock slot and
+// gives moving average and exponentially smoothed forecasts in O(1).
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_DEMANDHISTORY_H
+#define SANDWICH_BAR_DEMANDHISTORY_H
+
+#include <vector>
+#include "../FoodItems/BillOfMaterials.h"
+#include "../FoodItems/StockTable.h"
+
+class DemandHistory {
+public:
+    /** Constructor/Destructor */
+    DemandHistory(StockTable* table, int numBuckets, int ordersPerBucket, float smoothing);
+    ~DemandHistory();
+
+    /** Record Methods */
+    void record(const BillOfMaterials& bill);
+    long long getOrders();
+    long long getBucket();
+
+    /** Forecast Methods */
+    float getMovingAverage(int slot);
+    float getSmoothed(int slot);
+    int getOrdersPerBucket();
+
+private:
+    /** Private Variables */
+    StockTable* table;
+    int width;
+    int ordersPerBucket;
+    float smoothing;
+    long long orders;
+    long long bucket;
+
+    /** Slot History */
+    std::vector<int> counts;
+    std::vector<int> windowSums;
+    std::vector<float> smoothed;
+    std::vector<long long> lastBuckets;
+
+    /** Helper Methods */
+    void grow();
+    void roll(int slot);
+};
+
+
+#endif //SANDWICH_BAR_DEMANDHISTORY_H
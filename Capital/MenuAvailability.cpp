@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MenuAvailability.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Flattens the bills of every recipe in the catalog into one
+// requirement matrix so the whole menu can be checked against the
+// stock table at once. Produces a bitmap of the makeable recipes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MenuAvailability.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Creates an empty matrix. It must be built
+ * before it can be checked.
+ */
+MenuAvailability::MenuAvailability(){
+    recipeCount = -1;
+    builtChanges = 0;
+}
+
+/**
+ * Default destructor.
+ */
+MenuAvailability::~MenuAvailability(){ }
+
+/**
+ * Builds the requirement matrix from the compiled bills
+ * of every recipe. The matrix is stored row by row with
+ * only the non-zero requirements kept.
+ * @param recipes The catalog to build from.
+ * @param index The reference index of the catalog.
+ */
+void MenuAvailability::build(RecipeCatalog* recipes, ReferenceIndex* index){
+    builtChanges = index->getChanges();
+    offsets.clear();
+    slots.clear();
+    counts.clear();
+
+    //One row per recipe id.
+    recipeCount = recipes->getSize();
+    for (int i = 0; i < recipeCount; i++){
+        offsets.push_back(slots.size());
+
+        const vector<BillItem>& items = recipes->getRecipe(i)->getBill().getItems();
+        for (int j = 0; j < items.size(); j++){
+            slots.push_back(items[j].slot);
+            counts.push_back(items[j].count);
+        }
+    }
+    offsets.push_back(slots.size());
+
+    surplus.resize(slots.size());
+}
+
+/**
+ * Marks the matrix as stale so it gets rebuilt.
+ */
+void MenuAvailability::invalidate(){
+    recipeCount = -1;
+}
+
+/**
+ * Checks whether the matrix has to be rebuilt. Adding or
+ * removing food, or invalidating a compiled bill, changes
+ * the index after the matrix was built.
+ * @param index The reference index of the catalog.
+ * @return Boolean indicating whether the matrix is stale.
+ */
+bool MenuAvailability::isStale(ReferenceIndex* index){
+    return recipeCount == -1 || builtChanges != index->getChanges();
+}
+
+/**
+ * Gets the number of recipes the matrix was built for.
+ * @return The number of recipes or -1 if not built.
+ */
+int MenuAvailability::getRecipeCount(){
+    return recipeCount;
+}
+
+/**
+ * Checks every recipe against the stock table. Bit i of
+ * the bitmap is set if the recipe with id i can be made.
+ * @param table The stock table to check against.
+ * @param bitmap The bitmap to fill in.
+ */
+void MenuAvailability::check(const StockTable& table, vector<unsigned int>& bitmap){
+    bitmap.assign((recipeCount + 31) / 32, 0);
+    computeSurplus(table);
+
+    //A recipe is makeable if none of its entries went negative.
+    for (int i = 0; i < recipeCount; i++){
+        int combined = 0;
+        for (int j = offsets[i]; j < offsets[i + 1]; j++){
+            combined |= surplus[j];
+        }
+
+        if (combined >= 0) bitmap[i / 32] |= 1u << (i % 32);
+    }
+}
+
+/**
+ * Checks whether a recipe is set in an availability bitmap.
+ * @param bitmap The bitmap to check.
+ * @param id The id of the recipe.
+ * @return Boolean indicating whether the recipe can be made.
+ */
+bool MenuAvailability::isSet(const vector<unsigned int>& bitmap, int id){
+    return (bitmap[id / 32] >> (id % 32)) & 1u;
+}
+
+/**
+ * Computes how much stock would be left over for every
+ * entry of the matrix. Each slot is read from the table
+ * once, then gathered so the subtraction runs over
+ * contiguous arrays.
+ * @param table The stock table to check against.
+ */
+void MenuAvailability::computeSurplus(const StockTable& table){
+    levels.resize(table.getSize());
+    for (int i = 0; i < levels.size(); i++){
+        levels[i] = table.getQuantity(i);
+    }
+
+    int size = slots.size();
+    for (int i = 0; i < size; i++){
+        surplus[i] = levels[slots[i]];
+    }
+
+    int i = 0;
+#ifdef __SSE2__
+    //Four entries at a time.
+    for (; i + 4 <= size; i += 4){
+        __m128i have = _mm_loadu_si128((const __m128i*) &surplus[i]);
+        __m128i need = _mm_loadu_si128((const __m128i*) &counts[i]);
+        _mm_storeu_si128((__m128i*) &surplus[i], _mm_sub_epi32(have, need));
+    }
+#endif
+
+    //Scalar fallback and remainder.
+    for (; i < size; i++){
+        surplus[i] -= counts[i];
+    }
+}
@@ -0,0 +1,53 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MenuAvailability.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Flattens the bills of every recipe in the catalog into one
+// requirement matrix so the whole menu can be checked against the
+// stock table at once. Produces a bitmap of the makeable recipes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_MENUAVAILABILITY_H
+#define SANDWICH_BAR_MENUAVAILABILITY_H
+
+#include <vector>
+#include "RecipeCatalog.h"
+#include "../FoodItems/ReferenceIndex.h"
+#include "../FoodItems/StockTable.h"
+
+class MenuAvailability {
+public:
+    /** Constructor/Destructor */
+    MenuAvailability();
+    ~MenuAvailability();
+
+    /** Build Methods */
+    void build(RecipeCatalog* recipes, ReferenceIndex* index);
+    void invalidate();
+    bool isStale(ReferenceIndex* index);
+    int getRecipeCount();
+
+    /** Check Methods */
+    void check(const StockTable& table, std::vector<unsigned int>& bitmap);
+
+    /** Bitmap Methods */
+    static bool isSet(const std::vector<unsigned int>& bitmap, int id);
+
+private:
+    /** Private Variables */
+    int recipeCount;
+    unsigned int builtChanges;
+    std::vector<int> offsets;
+    std::vector<int> slots;
+    std::vector<int> counts;
+    std::vector<int> surplus;
+    std::vector<int> levels;
+
+    /** Helper Methods */
+    void computeSurplus(const StockTable& table);
+};
+
+
+#endif //SANDWICH_BAR_MENUAVAILABILITY_H
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PriceUpdate.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Applies a batch of new simple ingredient prices at once. Everything
+// built on the changed ingredients is recomputed a single time and the
+// menu items whose totals changed are reported.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <sstream>
+#include "PriceUpdate.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an empty batch.
+ */
+PriceUpdate::PriceUpdate(){ }
+
+/**
+ * Adds a new price to the batch. Nothing changes
+ * until the batch is applied.
+ * @param ing The ingredient to change.
+ * @param cost The new cost of the ingredient.
+ */
+void PriceUpdate::addChange(SimpleIngredient* ing, float cost){
+    ingredients.push_back(ing);
+    costs.push_back(cost);
+}
+
+/**
+ * Gets the number of prices in the batch.
+ * @return The number of prices.
+ */
+int PriceUpdate::getSize(){
+    return ingredients.size();
+}
+
+/**
+ * Applies every price in the batch. Every affected item is
+ * invalidated first and costs are recomputed lazily, so each
+ * item is computed once even when reused ids put it before
+ * something it depends on. The batch is emptied afterwards.
+ */
+void PriceUpdate::apply(){
+    changed.clear();
+    oldTotals.clear();
+    newTotals.clear();
+    if (ingredients.empty()) return;
+
+    ReferenceIndex* index = ingredients.at(0)->getIndex();
+    vector<int> ids;
+    for (int i = 0; i < ingredients.size(); i++){
+        ids.push_back(ingredients.at(i)->getId());
+    }
+    vector<int> reached = index->getReachable(ids);
+
+    //Records the menu totals before the change.
+    vector<Recipe*> menu;
+    vector<float> before;
+    for (int i = 0; i < reached.size(); i++){
+        Recipe* rec = dynamic_cast<Recipe*>(index->getFood(reached[i]));
+        if (rec == NULL) continue;
+
+        menu.push_back(rec);
+        before.push_back(rec->getTotalCost());
+    }
+
+    //Sets the new prices without invalidating one at a time.
+    for (int i = 0; i < ingredients.size(); i++){
+        ingredients.at(i)->getTable()->setCost(ingredients.at(i)->getSlot(), costs.at(i));
+    }
+    for (int i = 0; i < reached.size(); i++){
+        index->getFood(reached[i])->invalidate();
+    }
+
+    //Recomputes the affected items in order.
+    for (int i = 0; i < reached.size(); i++){
+        Food* current = index->getFood(reached[i]);
+        Ingredient* ing = dynamic_cast<Ingredient*>(current);
+        if (ing != NULL) ing->getCost();
+        else ((Recipe*) current)->getTotalCost();
+    }
+
+    //Reports the totals that changed.
+    for (int i = 0; i < menu.size(); i++){
+        float after = menu.at(i)->getTotalCost();
+        if (after == before.at(i)) continue;
+
+        changed.push_back(menu.at(i));
+        oldTotals.push_back(before.at(i));
+        newTotals.push_back(after);
+    }
+
+    ingredients.clear();
+    costs.clear();
+}
+
+/**
+ * Gets the recipes whose totals changed in the last batch.
+ * @return The changed recipes in id order.
+ */
+const vector<Recipe*>& PriceUpdate::getChangedRecipes(){
+    return changed;
+}
+
+/**
+ * Prints the recipes whose totals changed in the last batch.
+ * @return A string with the old and new totals.
+ */
+string PriceUpdate::print(){
+    if (changed.size() == 0) return "No menu prices changed.\n";
+    string text = "The following menu prices changed:\n";
+
+    for (int i = 0; i < changed.size(); i++){
+        text += "\t- " + changed.at(i)->getName() + ": $" + printCost(oldTotals.at(i)) +
+                " -> $" + printCost(newTotals.at(i)) + "\n";
+    }
+
+    return text;
+}
+
+/**
+ * Formats a cost with two decimal places.
+ * @param cost The cost to format.
+ * @return The formatted cost.
+ */
+string PriceUpdate::printCost(float cost){
+    stringstream costStream;
+    costStream << fixed
+               << setprecision(2)
+               << setfill( '0' ) << cost;
+
+    return costStream.str();
+}
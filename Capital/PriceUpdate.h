@@ -0,0 +1,47 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PriceUpdate.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Applies a batch of new simple ingredient prices at once. Everything
+// built on the changed ingredients is recomputed a single time and the
+// menu items whose totals changed are reported.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_PRICEUPDATE_H
+#define SANDWICH_BAR_PRICEUPDATE_H
+
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "../FoodItems/SimpleIngredient.h"
+
+class PriceUpdate {
+public:
+    /** Constructor */
+    PriceUpdate();
+
+    /** Batch Methods */
+    void addChange(SimpleIngredient* ing, float cost);
+    int getSize();
+    void apply();
+
+    /** Result Methods */
+    const std::vector<Recipe*>& getChangedRecipes();
+    std::string print();
+
+private:
+    /** Private Variables */
+    std::vector<SimpleIngredient*> ingredients;
+    std::vector<float> costs;
+    std::vector<Recipe*> changed;
+    std::vector<float> oldTotals;
+    std::vector<float> newTotals;
+
+    /** Helper Methods */
+    static std::string printCost(float cost);
+};
+
+
+#endif //SANDWICH_BAR_PRICEUPDATE_H
@@ -21,18 +21,24 @@ using namespace std;
  * @param name The name of the recipe.
  * @param ings The ingredients for the recipe.
  * @param premium The premium that he recipe uses.
+ * @param index The reference index of the bar.
  */
-Recipe::Recipe(std::string name, std::vector<Ingredient*> ings, float premium){
+Recipe::Recipe(std::string name, std::vector<Ingredient*> ings, float premium, ReferenceIndex* index)
+    : Food(index) {
     //Sets the name and list of ingredients.
     this->name = name;
     listOfIngredients = ings;
     this->premium = premium;
+    billCompiled = false;
+    costCached = false;
 
     //Used for testing Grok functionality.
     SandwichBar::numItems++;
 
-    //Manages the references.
-    manageReferences();
+    //Records what this recipe uses.
+    for (int i = 0; i < listOfIngredients.size(); i++){
+        addReference(listOfIngredients.at(i));
+    }
 }
 
 /**
@@ -46,16 +52,22 @@ Recipe::~Recipe(){ }
  * @return The total recipe cost.
  */
 float Recipe::getTotalCost(){
-    return subComponentCost() + premium;
+    return getRawCost() + premium;
 }
 
 /**
  * Gets the cost of the recipe.
- * Only ingredient cost.
+ * Only ingredient cost. The cost is kept
+ * until the recipe is invalidated.
  * @return The raw cost of the recipe.
  */
 float Recipe::getRawCost(){
-    return subComponentCost();
+    if (!costCached){
+        rawCost = computeRawCost();
+        costCached = true;
+    }
+
+    return rawCost;
 }
 
 /**
@@ -63,7 +75,7 @@ float Recipe::getRawCost(){
  * @return A boolean indicating whether the recipe can be made.
  */
 bool Recipe::canMake(){
-    return canMakeIngredients();
+    return getBill().canMake();
 }
 
 /**
@@ -71,27 +83,70 @@ bool Recipe::canMake(){
  * @return Whether the recipe was made.
  */
 bool Recipe::make(){
-    return makeIngredients();
+    return getBill().make();
 }
 
 /**
  * Indicates whether the recipe can be made.
  * Ignores removed ingredients.
- * @param removed A vector of ingredients to be removed.
+ * @param removed The ingredients to be removed.
  * @return Boolean indicating whether it can be made.
  */
-bool Recipe::canMake(std::vector<Ingredient*> removed){
-    return canMakeIngredients(removed);
+bool Recipe::canMake(IngredientSpan removed){
+    if (removed.empty()) return canMake();
+
+    //Removals change the bill so it is built on the spot.
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(removed, bill);
+    bill.compact();
+
+    return bill.canMake();
 }
 
 /**
  * Makes the recipe.
  * Ignores removed ingredients.
- * @param removed A vector of removed ingredients.
+ * @param removed The removed ingredients.
  * @return Boolean indicating success of it being made.
  */
-bool Recipe::make(std::vector<Ingredient*> removed){
-    return makeIngredients(removed);
+bool Recipe::make(IngredientSpan removed){
+    if (removed.empty()) return make();
+
+    //Removals change the bill so it is built on the spot.
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(removed, bill);
+    bill.compact();
+
+    return bill.make();
+}
+
+/**
+ * Adds the simple ingredients needed for this recipe
+ * to a bill of materials. Removed ingredients are skipped.
+ * The bill is left uncompacted.
+ * @param removed The removed ingredients.
+ * @param bill The bill to add to.
+ */
+void Recipe::appendBill(IngredientSpan removed, BillOfMaterials& bill){
+    appendIngredients(removed, bill);
+}
+
+/**
+ * Gets the compiled bill for the recipe with no removals.
+ * Compiles it on first use.
+ * @return The compiled bill of materials.
+ */
+const BillOfMaterials& Recipe::getBill(){
+    if (!billCompiled){
+        compiledBill.clear();
+        appendBill(IngredientSpan(), compiledBill);
+        compiledBill.compact();
+        billCompiled = true;
+    }
+
+    return compiledBill;
 }
 
 /**
@@ -140,7 +195,7 @@ string Recipe::getName(){
  * Gets all ingredients in the recipe.
  * @return A vector of ingredients in the recipe.
  */
-vector<Ingredient*> Recipe::getIngredients(){
+const vector<Ingredient*>& Recipe::getIngredients(){
     return listOfIngredients;
 }
 
@@ -154,17 +209,13 @@ bool Recipe::containsIngredient(string ingName){
     return findIngredient(ingName);
 }
 
-void Recipe::updateReferences(std::vector<Food*> references){
-    //We first go an update ourselves.
-    addReferences(references);
-
-    //We now add ourselves.
-    references.push_back(this);
-
-    //We finally go through the ingredients.
-    for (int i = 0; i < listOfIngredients.size(); i++){
-        listOfIngredients.at(i)->updateReferences(references);
-    }
+/**
+ * Drops the compiled bill and cost so they are
+ * rebuilt on next use.
+ */
+void Recipe::invalidate(){
+    billCompiled = false;
+    costCached = false;
 }
 
 /**
@@ -183,6 +234,23 @@ bool Recipe::findIngredient(string ingName){
     return false;
 }
 
+/**
+ * Gets the premium charged on top of the ingredients.
+ * @return The recipe premium.
+ */
+float Recipe::getPremium(){
+    return premium;
+}
+
+/**
+ * Gets the ingredients listed at this level of the
+ * recipe. A complex recipe lists only its additions.
+ * @return The ingredients at this level.
+ */
+const vector<Ingredient*>& Recipe::getOwnIngredients(){
+    return listOfIngredients;
+}
+
 /**
  * Helper method that returns the ingredients involved.
  * @return A vector of the ingredients.
@@ -206,93 +274,29 @@ float Recipe::subComponentCost() {
 }
 
 /**
- * Helper method which checks whether recipe can be made.
- * @return Whether the recipe can be made.
- */
-bool Recipe::canMakeIngredients(){
-    //Iterate through the list of ingredients to check.
-    for (int i = 0; i < listOfIngredients.size(); i++){
-        if (listOfIngredients.at(i)->canUse() == false){
-            return false;
-        }
-    }
-
-    return true;
-}
-
-/**
- * Makes the ingredients listed at this level of the
- * recipe.
- * @return Boolean indicating success.
- */
-bool Recipe::makeIngredients(){
-    if (!canMakeIngredients()) return false;
-
-    //Iterate and use.
-    for (int i = 0; i < listOfIngredients.size(); i++){
-        listOfIngredients.at(i)->useIngredient();
-    }
-
-    return true;
-}
-
-/**
- * Helper method which checks whether the ingredients
- * can be made at this level. Ignores removed ingredients.
- * @param removed A vector of removed ingredients.
- * @return Boolean indicating success.
+ * Computes the cost of the ingredients in
+ * the recipe.
+ * @return The raw cost of the recipe.
  */
-bool Recipe::canMakeIngredients(vector<Ingredient*> removed){
-    //We iterate through each of the ingredients.
-    for (int i = 0; i < listOfIngredients.size(); i++){
-        Ingredient* current = listOfIngredients.at(i);
-        bool removedIng = false;
-
-        //Iterate through the removed list.
-        for (int j = 0; j < removed.size(); j++){
-            if (current == removed.at(j)){
-                removedIng = true;
-                break;
-            }
-        }
-
-        if (!removedIng && !current->canUse()){
-            return false;
-        }
-    }
-
-    return true;
+float Recipe::computeRawCost(){
+    return subComponentCost();
 }
 
 /**
- * Helper method which makes ingredients at this level
- * of the recipe. Ignores removed ingredients.
- * @param removed Vector of removed ingredients.
- * @return A boolean indicating success.
+ * Helper method which adds the ingredients listed at this
+ * level of the recipe to a bill. Ignores removed ingredients.
+ * @param removed The removed ingredients.
+ * @param bill The bill to add to.
  */
-bool Recipe::makeIngredients(vector<Ingredient*> removed){
-    //Check if we can use it.
-    if (!canMakeIngredients(removed)) return false;
-
+void Recipe::appendIngredients(IngredientSpan removed, BillOfMaterials& bill){
     //We iterate through each of the ingredients.
     for (int i = 0; i < listOfIngredients.size(); i++){
         Ingredient* current = listOfIngredients.at(i);
-        bool removedIng = false;
-
-        //Iterate through the removed list.
-        for (int j = 0; j < removed.size(); j++){
-            if (current == removed.at(j)){
-                removedIng = true;
-                break;
-            }
-        }
 
-        if (!removedIng){
-            current->useIngredient();
+        if (!removed.contains(current)){
+            current->appendBill(bill, 1);
         }
     }
-
-    return true;
 }
 
 /**
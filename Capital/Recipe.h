@@ -15,11 +15,12 @@
 #include <vector>
 #include "../FoodItems/Food.h"
 #include "../FoodItems/Ingredient.h"
+#include "../FoodItems/IngredientSpan.h"
 
 class Recipe : public Food {
 public:
     /** Constructor/Destructor */
-    Recipe(std::string name, std::vector<Ingredient*> ings, float premium);
+    Recipe(std::string name, std::vector<Ingredient*> ings, float premium, ReferenceIndex* index);
     virtual ~Recipe();
 
     /** Cost Methods */
@@ -29,8 +30,12 @@ public:
     /** Make Methods */
     virtual bool canMake();
     virtual bool make();
-    virtual bool canMake(std::vector<Ingredient*> removed);
-    virtual bool make(std::vector<Ingredient*> removed);
+    virtual bool canMake(IngredientSpan removed);
+    virtual bool make(IngredientSpan removed);
+
+    /** Bill Methods */
+    virtual void appendBill(IngredientSpan removed, BillOfMaterials& bill);
+    const BillOfMaterials& getBill();
 
     /** Print Methods */
     virtual std::string print();
@@ -38,11 +43,15 @@ public:
     std::string getName();
 
     /** Ingredient Methods */
-    virtual std::vector<Ingredient*> getIngredients();
+    virtual const std::vector<Ingredient*>& getIngredients();
     virtual bool containsIngredient(std::string ingName);
 
+    /** Structure Methods */
+    float getPremium();
+    const std::vector<Ingredient*>& getOwnIngredients();
+
     /** Update Method */
-    virtual void updateReferences(std::vector<Food*> references);
+    void invalidate();
 
 protected:
     /** Protected Variables */
@@ -52,16 +61,18 @@ protected:
     bool findIngredient(std::string ingName);
     std::vector<Ingredient*> getSubComponents();
     float subComponentCost();
-    bool canMakeIngredients();
-    bool makeIngredients();
-    bool canMakeIngredients(std::vector<Ingredient*> removed);
-    bool makeIngredients(std::vector<Ingredient*> removed);
+    virtual float computeRawCost();
+    void appendIngredients(IngredientSpan removed, BillOfMaterials& bill);
     std::string printNameStatus();
 
 private:
     /** Private Variable */
     std::string name;
     std::vector<Ingredient*> listOfIngredients;
+    BillOfMaterials compiledBill;
+    bool billCompiled;
+    float rawCost;
+    bool costCached;
 };
 
 
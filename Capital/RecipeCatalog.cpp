@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RecipeCatalog.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Owns all the recipes offered by the sandwich bar. Indexes the
+// recipes by name and by a stable integer id so they can be looked
+// up without scanning the whole menu.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RecipeCatalog.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an empty catalog.
+ */
+RecipeCatalog::RecipeCatalog(){
+    recipes = new vector<Recipe*>();
+    recipeIndex = new unordered_map<string, int>();
+}
+
+/**
+ * Destructor which deletes all recipes in the catalog.
+ */
+RecipeCatalog::~RecipeCatalog(){
+    for (int i = 0; i < recipes->size(); i++)
+        delete recipes->at(i);
+
+    delete recipes;
+    delete recipeIndex;
+}
+
+/**
+ * Adds a recipe to the catalog. The catalog takes ownership
+ * of the recipe unless the name is already taken.
+ * @param recipe The recipe to add.
+ * @return The id of the recipe or -1 if it is a duplicate.
+ */
+int RecipeCatalog::addRecipe(Recipe* recipe){
+    string name = recipe->getName();
+    if (exists(name)) return -1;
+
+    //Ids are positions in the catalog and never change.
+    int id = recipes->size();
+    recipes->push_back(recipe);
+    (*recipeIndex)[name] = id;
+
+    return id;
+}
+
+/**
+ * Checks whether a recipe exists by name.
+ * @param name The name of the recipe.
+ * @return Boolean indicating whether it exists.
+ */
+bool RecipeCatalog::exists(const string& name){
+    return getRecipeId(name) != -1;
+}
+
+/**
+ * Gets a recipe by name.
+ * @param name The name of the recipe.
+ * @return A pointer to the recipe or NULL.
+ */
+Recipe* RecipeCatalog::getRecipe(const string& name){
+    int id = getRecipeId(name);
+    if (id == -1) return NULL;
+
+    return recipes->at(id);
+}
+
+/**
+ * Gets a recipe by its id.
+ * @param id The id of the recipe.
+ * @return A pointer to the recipe or NULL.
+ */
+Recipe* RecipeCatalog::getRecipe(int id){
+    if (id < 0 || id >= recipes->size()) return NULL;
+
+    return recipes->at(id);
+}
+
+/**
+ * Gets the id of a recipe by name.
+ * @param name The name of the recipe.
+ * @return The id of the recipe or -1.
+ */
+int RecipeCatalog::getRecipeId(const string& name){
+    unordered_map<string, int>::const_iterator it = recipeIndex->find(name);
+    if (it == recipeIndex->end()) return -1;
+
+    return it->second;
+}
+
+/**
+ * Gets the number of recipes in the catalog.
+ * @return The catalog size.
+ */
+int RecipeCatalog::getSize(){
+    return recipes->size();
+}
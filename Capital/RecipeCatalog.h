@@ -0,0 +1,43 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RecipeCatalog.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Owns all the recipes offered by the sandwich bar. Indexes the
+// recipes by name and by a stable integer id so they can be looked
+// up without scanning the whole menu.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_RECIPECATALOG_H
+#define SANDWICH_BAR_RECIPECATALOG_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Recipe.h"
+
+class RecipeCatalog {
+public:
+    /** Constructor/Destructor */
+    RecipeCatalog();
+    ~RecipeCatalog();
+
+    /** Add Methods */
+    int addRecipe(Recipe* recipe);
+
+    /** Lookup Methods */
+    bool exists(const std::string& name);
+    Recipe* getRecipe(const std::string& name);
+    Recipe* getRecipe(int id);
+    int getRecipeId(const std::string& name);
+    int getSize();
+
+private:
+    /** Private Variables */
+    std::vector<Recipe*>* recipes;
+    std::unordered_map<std::string, int>* recipeIndex;
+};
+
+
+#endif //SANDWICH_BAR_RECIPECATALOG_H
@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RestockPlanner.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Plans restocks for the bar. Keeps a reorder point and reorder quantity
+// for every simple ingredient, adds up what pending orders need and buys
+// everything that is short in one consolidated purchase.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <sstream>
+#include "RestockPlanner.h"
+
+using namespace std;
+
+/**
+ * Creates a planner for a stock table. Every slot starts
+ * with the same reorder point and reorder quantity.
+ * @param table The stock table to restock.
+ * @param reorderPoint Stock left below which a slot is reordered.
+ * @param reorderQuantity How much extra to order for a slot.
+ */
+RestockPlanner::RestockPlanner(StockTable* table, int reorderPoint, int reorderQuantity){
+    this->table = table;
+    defaultPoint = reorderPoint;
+    defaultQuantity = reorderQuantity;
+    cost = 0;
+}
+
+/**
+ * Default destructor. The stock table is not owned.
+ */
+RestockPlanner::~RestockPlanner(){ }
+
+/**
+ * Copies the reorder points and quantities of another
+ * planner. Used when planning for a copy of the stock.
+ * @param other The planner to copy from.
+ */
+void RestockPlanner::setPolicies(const RestockPlanner& other){
+    defaultPoint = other.defaultPoint;
+    defaultQuantity = other.defaultQuantity;
+    reorderPoints = other.reorderPoints;
+    reorderQuantities = other.reorderQuantities;
+}
+
+/**
+ * Sets the reorder point and quantity of one slot.
+ * @param slot The slot of the simple ingredient.
+ * @param reorderPoint Stock left below which the slot is reordered.
+ * @param reorderQuantity How much extra to order for the slot.
+ * @return Boolean indicating whether the policy was valid.
+ */
+bool RestockPlanner::setPolicy(int slot, int reorderPoint, int reorderQuantity){
+    grow();
+    if (slot < 0 || slot >= reorderPoints.size()) return false;
+    if (reorderPoint < 0 || reorderQuantity < 0) return false;
+
+    reorderPoints[slot] = reorderPoint;
+    reorderQuantities[slot] = reorderQuantity;
+    return true;
+}
+
+/**
+ * Gets the reorder point of a slot.
+ * @param slot The slot of the simple ingredient.
+ * @return The reorder point.
+ */
+int RestockPlanner::getReorderPoint(int slot){
+    grow();
+    return reorderPoints.at(slot);
+}
+
+/**
+ * Gets the reorder quantity of a slot.
+ * @param slot The slot of the simple ingredient.
+ * @return The reorder quantity.
+ */
+int RestockPlanner::getReorderQuantity(int slot){
+    grow();
+    return reorderQuantities.at(slot);
+}
+
+/**
+ * Adds the needs of a pending order. Needs of
+ * several orders are added together.
+ * @param bill The bill of the pending order.
+ */
+void RestockPlanner::addDemand(const BillOfMaterials& bill){
+    grow();
+
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        if (demand[items[i].slot] == 0 && items[i].count > 0) touched.push_back(items[i].slot);
+        demand[items[i].slot] += items[i].count;
+    }
+}
+
+/**
+ * Forgets the needs of every pending order.
+ */
+void RestockPlanner::clearDemand(){
+    for (int i = 0; i < touched.size(); i++){
+        demand[touched[i]] = 0;
+    }
+    touched.clear();
+}
+
+/**
+ * Plans a purchase for the slots the pending orders
+ * need. Anything the orders are short is always bought.
+ * @return The cost of the purchase.
+ */
+float RestockPlanner::plan(){
+    purchases.clear();
+    cost = 0;
+
+    for (int i = 0; i < touched.size(); i++){
+        planSlot(touched[i]);
+    }
+
+    return cost;
+}
+
+/**
+ * Plans a purchase for every slot in the table,
+ * including the needs of any pending orders.
+ * @return The cost of the purchase.
+ */
+float RestockPlanner::planAll(){
+    grow();
+    purchases.clear();
+    cost = 0;
+
+    for (int i = 0; i < table->getSize(); i++){
+        planSlot(i);
+    }
+
+    return cost;
+}
+
+/**
+ * Buys the planned purchase in one go. Nothing is
+ * bought unless the whole purchase can be afforded.
+ * @param funds The funds to pay from.
+ * @return Boolean indicating whether it was bought.
+ */
+bool RestockPlanner::purchase(float& funds){
+    if (funds < cost) return false;
+
+    funds -= cost;
+    for (int i = 0; i < purchases.size(); i++){
+        table->addStock(purchases[i].slot, purchases[i].amount);
+    }
+
+    return true;
+}
+
+/**
+ * Gets the purchases in the last plan.
+ * @return The planned purchases.
+ */
+const vector<RestockItem>& RestockPlanner::getPurchases(){
+    return purchases;
+}
+
+/**
+ * Gets the cost of the last plan.
+ * @return The cost of the purchase.
+ */
+float RestockPlanner::getCost(){
+    return cost;
+}
+
+/**
+ * Prints the last plan.
+ * @param inventory The inventory holding the ingredient names.
+ * @return String describing the purchase.
+ */
+string RestockPlanner::print(Inventory* inventory){
+    if (purchases.size() == 0) return "Nothing needs to be restocked.\n";
+    string text = "The following ingredients will be restocked:\n";
+
+    for (int i = 0; i < purchases.size(); i++){
+        text += "\t- " + inventory->getSlotName(purchases[i].slot) + ": " +
+                to_string(purchases[i].amount) + " for $" + printCost(purchases[i].cost) + "\n";
+    }
+    text += "Total cost: $" + printCost(cost) + "\n";
+
+    return text;
+}
+
+/**
+ * Makes sure every slot in the table has a policy
+ * and a demand count. New slots get the defaults.
+ */
+void RestockPlanner::grow(){
+    int size = table->getSize();
+
+    //Copied policies and the demand can lag behind separately.
+    if (reorderPoints.size() < size) reorderPoints.resize(size, defaultPoint);
+    if (reorderQuantities.size() < size) reorderQuantities.resize(size, defaultQuantity);
+    if (demand.size() < size) demand.resize(size, 0);
+}
+
+/**
+ * Plans one slot. A slot is bought when the stock left
+ * after the pending orders falls below its reorder point.
+ * The reorder quantity is bought on top of any shortfall.
+ * @param slot The slot to plan.
+ */
+void RestockPlanner::planSlot(int slot){
+    int left = table->getQuantity(slot) - demand[slot];
+    if (left >= 0 && left >= reorderPoints[slot]) return;
+
+    RestockItem item;
+    item.slot = slot;
+    item.amount = reorderQuantities[slot] + (left < 0 ? -left : 0);
+    if (item.amount == 0) return;
+
+    item.cost = item.amount * table->getCost(slot);
+    purchases.push_back(item);
+    cost += item.cost;
+}
+
+/**
+ * Formats a cost with two decimal places.
+ * @param cost The cost to format.
+ * @return The formatted cost.
+ */
+string RestockPlanner::printCost(float cost){
+    stringstream costStream;
+    costStream << fixed
+               << setprecision(2)
+               << setfill( '0' ) << cost;
+
+    return costStream.str();
+}
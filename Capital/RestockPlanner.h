@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RestockPlanner.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Plans restocks for the bar. Keeps a reorder point and reorder quantity
+// for every simple ingredient, adds up what pending orders need and buys
+// everything that is short in one consolidated purchase.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_RESTOCKPLANNER_H
+#define SANDWICH_BAR_RESTOCKPLANNER_H
+
+#include <string>
+#include <vector>
+#include "../FoodItems/Inventory.h"
+#include "../FoodItems/StockTable.h"
+
+struct RestockItem {
+    int slot;
+    int amount;
+    float cost;
+};
+
+class RestockPlanner {
+public:
+    /** Constructor/Destructor */
+    RestockPlanner(StockTable* table, int reorderPoint, int reorderQuantity);
+    ~RestockPlanner();
+
+    /** Policy Methods */
+    void setPolicies(const RestockPlanner& other);
+    bool setPolicy(int slot, int reorderPoint, int reorderQuantity);
+    int getReorderPoint(int slot);
+    int getReorderQuantity(int slot);
+
+    /** Demand Methods */
+    void addDemand(const BillOfMaterials& bill);
+    void clearDemand();
+
+    /** Plan Methods */
+    float plan();
+    float planAll();
+    bool purchase(float& funds);
+
+    /** Result Methods */
+    const std::vector<RestockItem>& getPurchases();
+    float getCost();
+    std::string print(Inventory* inventory);
+
+private:
+    /** Private Variables */
+    StockTable* table;
+    int defaultPoint;
+    int defaultQuantity;
+    std::vector<int> reorderPoints;
+    std::vector<int> reorderQuantities;
+    std::vector<int> demand;
+    std::vector<int> touched;
+    std::vector<RestockItem> purchases;
+    float cost;
+
+    /** Helper Methods */
+    void grow();
+    void planSlot(int slot);
+    static std::string printCost(float cost);
+};
+
+
+#endif //SANDWICH_BAR_RESTOCKPLANNER_H
@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockoutImpact.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Works out which complex ingredients and recipes can no longer be made
+// when one or more ingredients run out. Walks the reference index from
+// the missing ingredients instead of checking the whole menu.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "StockoutImpact.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an empty result.
+ */
+StockoutImpact::StockoutImpact(){ }
+
+/**
+ * Finds everything affected by a set of missing ingredients.
+ * Complex ingredients need all of their parts, so any of them
+ * reached is affected. A recipe reached through its base may
+ * have removed the missing item, so recipes are checked
+ * against the ingredients they actually use.
+ * @param missing The ingredients that ran out.
+ */
+void StockoutImpact::compute(const vector<Ingredient*>& missing){
+    ingredients.clear();
+    recipes.clear();
+    if (missing.empty()) return;
+
+    ReferenceIndex* index = missing.at(0)->getIndex();
+    vector<int> ids;
+    vector<unsigned int> affected(index->getSize() / 32 + 1, 0);
+    for (int i = 0; i < missing.size(); i++){
+        int id = missing.at(i)->getId();
+        ids.push_back(id);
+        affected[id / 32] |= 1u << (id % 32);
+    }
+
+    //Ingredients only use ingredients, so mark them first.
+    vector<int> reached = index->getReachable(ids);
+    for (int i = 0; i < reached.size(); i++){
+        Ingredient* ing = dynamic_cast<Ingredient*>(index->getFood(reached[i]));
+        if (ing == NULL) continue;
+
+        ingredients.push_back(ing);
+        affected[reached[i] / 32] |= 1u << (reached[i] % 32);
+    }
+
+    //Now checks the recipes that were reached.
+    for (int i = 0; i < reached.size(); i++){
+        Recipe* rec = dynamic_cast<Recipe*>(index->getFood(reached[i]));
+        if (rec == NULL) continue;
+
+        const vector<Ingredient*>& uses = rec->getIngredients();
+        for (int j = 0; j < uses.size(); j++){
+            int id = uses.at(j)->getId();
+            if ((affected[id / 32] >> (id % 32)) & 1u){
+                recipes.push_back(rec);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Gets the ingredients that can no longer be made.
+ * @return The affected ingredients in id order.
+ */
+const vector<Ingredient*>& StockoutImpact::getIngredients(){
+    return ingredients;
+}
+
+/**
+ * Gets the recipes that can no longer be made.
+ * @return The affected recipes in id order.
+ */
+const vector<Recipe*>& StockoutImpact::getRecipes(){
+    return recipes;
+}
+
+/**
+ * Prints the affected ingredients and recipes.
+ * @return A string with the result.
+ */
+string StockoutImpact::print(){
+    string text = "\t- Ingredients: ";
+    text += printList(vector<Food*>(ingredients.begin(), ingredients.end()));
+    text += "\n\t- Recipes: ";
+    text += printList(vector<Food*>(recipes.begin(), recipes.end()));
+    text += "\n";
+
+    return text;
+}
+
+/**
+ * Prints a list of food item names.
+ * @param items The food items to print.
+ * @return String containing the names.
+ */
+string StockoutImpact::printList(const vector<Food*>& items){
+    if (items.size() == 0) return "None";
+    string text = "{";
+
+    for (int i = 0; i < items.size(); i++){
+        text += items.at(i)->getName();
+        if (i + 1 < items.size()){
+            text += ", ";
+        }
+    }
+    text += "}";
+
+    return text;
+}
@@ -0,0 +1,42 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockoutImpact.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Works out which complex ingredients and recipes can no longer be made
+// when one or more ingredients run out. Walks the reference index from
+// the missing ingredients instead of checking the whole menu.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_STOCKOUTIMPACT_H
+#define SANDWICH_BAR_STOCKOUTIMPACT_H
+
+#include <string>
+#include <vector>
+#include "Recipe.h"
+
+class StockoutImpact {
+public:
+    /** Constructor */
+    StockoutImpact();
+
+    /** Query Methods */
+    void compute(const std::vector<Ingredient*>& missing);
+    const std::vector<Ingredient*>& getIngredients();
+    const std::vector<Recipe*>& getRecipes();
+
+    /** Print Methods */
+    std::string print();
+
+private:
+    /** Private Variables */
+    std::vector<Ingredient*> ingredients;
+    std::vector<Recipe*> recipes;
+
+    /** Helper Methods */
+    static std::string printList(const std::vector<Food*>& items);
+};
+
+
+#endif //SANDWICH_BAR_STOCKOUTIMPACT_H
@@ -0,0 +1,308 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CompactOrder.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Compact form of an order for high-rate intake. Sandwiches are stored
+// as recipe ids with their substitutions kept in one shared list of
+// ingredient ids, so an order needs no per-sandwich allocations. Every
+// id is kept with its generation, so an order that refers to an item
+// removed from the bar is refused rather than made.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompactOrder.h"
+
+using namespace std;
+
+/**
+ * Constructor that creates an empty compact order
+ * for a certain person.
+ * @param name The name of the person for the order.
+ */
+CompactOrder::CompactOrder(string name) : name(name) {
+    totalCost = 0;
+    index = NULL;
+}
+
+/**
+ * Constructor that converts an existing order. The
+ * order is left untouched.
+ * @param order The order to convert.
+ */
+CompactOrder::CompactOrder(Order* order) : name(order->getName()) {
+    totalCost = 0;
+    index = NULL;
+
+    const SandwichList& list = order->getSandwiches();
+    sandwiches.reserve(list.size());
+    for (int i = 0; i < list.size(); i++){
+        addSandwich(list.at(i));
+    }
+}
+
+/**
+ * Adds a sandwich made exactly as the recipe says.
+ * @param recipe The recipe of the sandwich.
+ * @return The position of the sandwich.
+ */
+int CompactOrder::addSandwich(Recipe* recipe){
+    CompactSandwich sandwich;
+    index = recipe->getIndex();
+    sandwich.recipeId = recipe->getId();
+    sandwich.recipeGeneration = index->getGeneration(sandwich.recipeId);
+    sandwich.firstItem = items.size();
+    sandwich.numAdditions = 0;
+    sandwich.numRemovals = 0;
+    sandwich.substituted = false;
+
+    sandwiches.push_back(sandwich);
+    totalCost += getSandwichCost(sandwich);
+
+    return sandwiches.size() - 1;
+}
+
+/**
+ * Adds a sandwich with a substitution. Views chained
+ * onto either list are added as well.
+ * @param recipe The recipe of the sandwich.
+ * @param additions The ingredients being added.
+ * @param removals The ingredients being removed.
+ * @return The position of the sandwich.
+ */
+int CompactOrder::addSandwich(Recipe* recipe, IngredientSpan additions, IngredientSpan removals){
+    CompactSandwich sandwich;
+    index = recipe->getIndex();
+    sandwich.recipeId = recipe->getId();
+    sandwich.recipeGeneration = index->getGeneration(sandwich.recipeId);
+    sandwich.firstItem = items.size();
+    sandwich.substituted = true;
+
+    //Additions come first, then the removals.
+    sandwich.numAdditions = addItems(additions);
+    sandwich.numRemovals = addItems(removals);
+
+    sandwiches.push_back(sandwich);
+    totalCost += getSandwichCost(sandwich);
+
+    return sandwiches.size() - 1;
+}
+
+/**
+ * Adds a copy of an existing sandwich.
+ * @param sandwich The sandwich to convert.
+ * @return The position of the sandwich.
+ */
+int CompactOrder::addSandwich(Sandwich* sandwich){
+    if (!sandwich->hasSubstitution()) return addSandwich(sandwich->getRecipe());
+
+    Substitution* subs = sandwich->getSubstitution();
+    return addSandwich(sandwich->getRecipe(), subs->getAdditions(), subs->getRemovals());
+}
+
+/**
+ * Removes every sandwich so the order can be reused.
+ * The name and the storage are kept.
+ */
+void CompactOrder::clear(){
+    sandwiches.clear();
+    items.clear();
+    generations.clear();
+    totalCost = 0;
+}
+
+/**
+ * Makes the order. Nothing is used unless the whole
+ * order can be made. A stale order is never made.
+ * @return Whether the order can be created.
+ */
+bool CompactOrder::makeOrder(){
+    if (isStale()) return false;
+
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(bill);
+    bill.compact();
+
+    return bill.make();
+}
+
+/**
+ * Checks whether any recipe or ingredient in the order was
+ * removed from the bar since it was added. The ids of a
+ * stale order may point at nothing or at a different item.
+ * Removing items the order does not use leaves it as is.
+ * @return Boolean indicating whether the order is stale.
+ */
+bool CompactOrder::isStale(){
+    for (int i = 0; i < sandwiches.size(); i++){
+        if (!index->isCurrent(sandwiches[i].recipeId, sandwiches[i].recipeGeneration)) return true;
+    }
+    for (int i = 0; i < items.size(); i++){
+        if (!index->isCurrent(items[i], generations[i])) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Gets the total cost of the order.
+ * @return The total cost of the order.
+ */
+float CompactOrder::getTotalCost(){
+    return totalCost;
+}
+
+/**
+ * Gets the number of sandwiches in the order.
+ * @return The number of sandwiches.
+ */
+int CompactOrder::getSandwichCount(){
+    return sandwiches.size();
+}
+
+/**
+ * Gets the name of the person for the order.
+ * @return The name on the order.
+ */
+const string& CompactOrder::getName(){
+    return name;
+}
+
+/**
+ * Adds the simple ingredients needed for every sandwich
+ * in the order to a bill of materials. The bill is left
+ * uncompacted. Nothing is added for a stale order.
+ * @param bill The bill to add to.
+ */
+void CompactOrder::appendBill(BillOfMaterials& bill){
+    if (isStale()) return;
+
+    static thread_local vector<Ingredient*> removed;
+
+    for (int i = 0; i < sandwiches.size(); i++){
+        const CompactSandwich& current = sandwiches[i];
+        Recipe* recipe = getRecipe(current.recipeId);
+        if (!current.substituted){
+            bill.addBill(recipe->getBill());
+            continue;
+        }
+
+        //The recipe checks removals by pointer.
+        const int* ids = items.data() + current.firstItem;
+        removed.clear();
+        for (int j = 0; j < current.numRemovals; j++){
+            removed.push_back(getIngredient(ids[current.numAdditions + j]));
+        }
+        recipe->appendBill(removed, bill);
+
+        //Apply the additions.
+        for (int j = 0; j < current.numAdditions; j++){
+            getIngredient(ids[j])->appendBill(bill, 1);
+        }
+    }
+}
+
+/**
+ * Prints the order details in the same form as
+ * a regular order.
+ * @return String containing the order details.
+ */
+string CompactOrder::printOrder(){
+    if (isStale()) return name + " has an order that is no longer on the menu.\n";
+
+    string orderText = name + " has made the following order:\n";
+    for (int i = 0; i < sandwiches.size(); i++){
+        orderText += "\t-" + printSandwich(sandwiches[i]) + "\n";
+    }
+
+    return orderText;
+}
+
+/**
+ * Adds the ids and generations of every ingredient in
+ * a view and the views chained after it.
+ * @param span The ingredients to add.
+ * @return The number of ids added.
+ */
+int CompactOrder::addItems(const IngredientSpan& span){
+    int count = 0;
+    for (const IngredientSpan* current = &span; current != NULL; current = current->next){
+        for (int i = 0; i < current->count; i++){
+            int id = current->items[i]->getId();
+            items.push_back(id);
+            generations.push_back(index->getGeneration(id));
+        }
+        count += current->count;
+    }
+
+    return count;
+}
+
+/**
+ * Looks up a recipe by its food id.
+ * @param id The id of the recipe.
+ * @return The recipe.
+ */
+Recipe* CompactOrder::getRecipe(int id){
+    //Ids only ever come from recipes added to the order.
+    return static_cast<Recipe*>(index->getFood(id));
+}
+
+/**
+ * Looks up an ingredient by its food id.
+ * @param id The id of the ingredient.
+ * @return The ingredient.
+ */
+Ingredient* CompactOrder::getIngredient(int id){
+    //Ids only ever come from ingredients added to the order.
+    return static_cast<Ingredient*>(index->getFood(id));
+}
+
+/**
+ * Gets the cost of one sandwich. Adds up the same
+ * way as a regular sandwich.
+ * @param sandwich The sandwich to cost.
+ * @return The cost of the sandwich.
+ */
+float CompactOrder::getSandwichCost(const CompactSandwich& sandwich){
+    float cost = getRecipe(sandwich.recipeId)->getTotalCost();
+    if (!sandwich.substituted) return cost;
+
+    const int* ids = items.data() + sandwich.firstItem;
+    float addCost = 0;
+    for (int i = 0; i < sandwich.numAdditions; i++){
+        addCost += getIngredient(ids[i])->getCost();
+    }
+    float removeCost = 0;
+    for (int i = 0; i < sandwich.numRemovals; i++){
+        removeCost += getIngredient(ids[sandwich.numAdditions + i])->getCost();
+    }
+
+    cost += addCost;
+    cost -= removeCost;
+    return cost;
+}
+
+/**
+ * Prints one sandwich in the same form as a
+ * regular sandwich.
+ * @param sandwich The sandwich to print.
+ * @return String describing the sandwich.
+ */
+string CompactOrder::printSandwich(const CompactSandwich& sandwich){
+    string sand = "A " + getRecipe(sandwich.recipeId)->getName() + " sandwich";
+    if (!sandwich.substituted) return sand + ".";
+
+    //Reuses the substitution wording.
+    Substitution subs;
+    const int* ids = items.data() + sandwich.firstItem;
+    for (int i = 0; i < sandwich.numAdditions; i++){
+        subs.addAddition(getIngredient(ids[i]));
+    }
+    for (int i = 0; i < sandwich.numRemovals; i++){
+        subs.addRemoval(getIngredient(ids[sandwich.numAdditions + i]));
+    }
+
+    return sand + " with " + subs.printSubstitution();
+}
@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CompactOrder.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Compact form of an order for high-rate intake. Sandwiches are stored
+// as recipe ids with their substitutions kept in one shared list of
+// ingredient ids, so an order needs no per-sandwich allocations. Every
+// id is kept with its generation, so an order that refers to an item
+// removed from the bar is refused rather than made.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_COMPACTORDER_H
+#define SANDWICH_BAR_COMPACTORDER_H
+
+#include <string>
+#include <vector>
+#include "Order.h"
+
+struct CompactSandwich {
+    int recipeId;
+    unsigned int recipeGeneration;
+    int firstItem;
+    int numAdditions;
+    int numRemovals;
+    bool substituted;
+};
+
+class CompactOrder {
+public:
+    /** Constructors */
+    CompactOrder(std::string name);
+    CompactOrder(Order* order);
+
+    /** Sandwich Operations */
+    int addSandwich(Recipe* recipe);
+    int addSandwich(Recipe* recipe, IngredientSpan additions, IngredientSpan removals);
+    int addSandwich(Sandwich* sandwich);
+    void clear();
+
+    /** Order Operations */
+    bool makeOrder();
+    bool isStale();
+    float getTotalCost();
+    int getSandwichCount();
+    const std::string& getName();
+
+    /** Bill Methods */
+    void appendBill(BillOfMaterials& bill);
+
+    /** Print Methods */
+    std::string printOrder();
+
+private:
+    /** Private Variables */
+    std::string name;
+    float totalCost;
+    std::vector<CompactSandwich> sandwiches;
+    std::vector<int> items;
+    std::vector<unsigned int> generations;
+    ReferenceIndex* index;
+
+    /** Helper Methods */
+    int addItems(const IngredientSpan& span);
+    Recipe* getRecipe(int id);
+    Ingredient* getIngredient(int id);
+    float getSandwichCost(const CompactSandwich& sandwich);
+    std::string printSandwich(const CompactSandwich& sandwich);
+};
+
+
+#endif //SANDWICH_BAR_COMPACTORDER_H
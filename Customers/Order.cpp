@@ -19,16 +19,30 @@ using namespace std;
  * @param name The name of the person for the order.
  */
 Order::Order(std::string name) : name(name) {
-    sandwiches = vector<Sandwich*>();
+    arena = NULL;
+    totalCost = 0;
+}
+
+/**
+ * Constructor that creates an order inside an order
+ * arena. Its sandwiches must be in the same arena.
+ * @param name The name of the person for the order.
+ * @param arena The arena holding the order.
+ */
+Order::Order(std::string name, OrderArena* arena)
+    : name(name), arena(arena), sandwiches(ArenaAllocator<Sandwich*>(arena)) {
     totalCost = 0;
 }
 
 /**
  * Destructor which deletes all sandwiches in the order.
+ * Sandwiches in an arena are only destroyed in place.
  */
 Order::~Order() {
-    for (int i = 0; i < sandwiches.size(); i++)
-        delete sandwiches.at(i);
+    for (int i = 0; i < sandwiches.size(); i++){
+        if (arena == NULL) delete sandwiches.at(i);
+        else sandwiches.at(i)->~Sandwich();
+    }
 }
 
 /**
@@ -59,22 +73,18 @@ void Order::removeSandwich(int sandwichNum){
 }
 
 /**
- * Makes the order.
+ * Makes the order. The needs of every sandwich are added
+ * up first so sandwiches sharing an ingredient are checked
+ * together. Nothing is used unless the whole order can be made.
  * @return Whether the order can be created.
  */
 bool Order::makeOrder() {
-    //Check if we can make the sandwich.
-    for (int i = 0; i < sandwiches.size(); i++){
-        if (!sandwiches.at(i)->canMake()) return false;
-    }
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(bill);
+    bill.compact();
 
-    //Makes the sandwich.
-    for (int i = 0; i < sandwiches.size(); i++){
-        sandwiches.at(i)->make();
-    }
-
-    //Notes that the order has been made.
-    return true;
+    return bill.make();
 }
 
 /**
@@ -89,10 +99,38 @@ float Order::getTotalCost() {
  * Gets all sandwiches referenced in the order.
  * @return The sandwiches in the order.
  */
-vector<Sandwich*> Order::getSandwiches(){
+const SandwichList& Order::getSandwiches(){
     return sandwiches;
 }
 
+/**
+ * Gets the number of sandwiches in the order.
+ * @return The number of sandwiches.
+ */
+int Order::getSandwichCount(){
+    return sandwiches.size();
+}
+
+/**
+ * Gets the name of the person for the order.
+ * @return The name on the order.
+ */
+const string& Order::getName(){
+    return name;
+}
+
+/**
+ * Adds the simple ingredients needed for every sandwich
+ * in the order to a bill of materials. The bill is left
+ * uncompacted.
+ * @param bill The bill to add to.
+ */
+void Order::appendBill(BillOfMaterials& bill){
+    for (int i = 0; i < sandwiches.size(); i++){
+        sandwiches.at(i)->appendBill(bill);
+    }
+}
+
 /**
  * Prints the order details.
  * @return String containing the order details.
@@ -13,13 +13,17 @@
 #define SANDWICH_BAR_ORDER_H
 
 #include "Sandwich.h"
+#include "OrderArena.h"
 #include <string>
 #include <vector>
 
+typedef std::vector<Sandwich*, ArenaAllocator<Sandwich*> > SandwichList;
+
 class Order {
 public:
     /** Constructor/Destructor */
     Order(std::string name);
+    Order(std::string name, OrderArena* arena);
     ~Order();
 
     /** Sandwich Operations */
@@ -29,7 +33,12 @@ public:
     /** Order Operations */
     bool makeOrder();
     float getTotalCost();
-    std::vector<Sandwich*> getSandwiches();
+    const SandwichList& getSandwiches();
+    int getSandwichCount();
+    const std::string& getName();
+
+    /** Bill Methods */
+    void appendBill(BillOfMaterials& bill);
 
     /** Print Methods */
     std::string printOrder();
@@ -38,7 +47,8 @@ private:
     /** Private Variables */
     std::string name;
     float totalCost;
-    std::vector<Sandwich*> sandwiches;
+    OrderArena* arena;
+    SandwichList sandwiches;
 
     /** Helper Method */
     void updateTotalCost();
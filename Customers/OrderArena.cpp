@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderArena.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Bump allocator for everything that belongs to a single order. Orders,
+// sandwiches, substitutions and their lists are carved out of reused
+// blocks and all freed at once when the arena is reset.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OrderArena.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an arena with one block.
+ */
+OrderArena::OrderArena(){
+    current = 0;
+    offset = 0;
+    addBlock(BLOCK_SIZE);
+}
+
+/**
+ * Destructor which frees every block.
+ */
+OrderArena::~OrderArena(){
+    for (int i = 0; i < blocks.size(); i++){
+        delete[] blocks.at(i);
+    }
+}
+
+/**
+ * Carves memory out of the current block. Moves on to
+ * the next block when it is full, adding one if needed.
+ * @param size The number of bytes.
+ * @param alignment The alignment of the memory.
+ * @return The memory.
+ */
+void* OrderArena::allocate(size_t size, size_t alignment){
+    size_t start = (offset + alignment - 1) & ~(alignment - 1);
+
+    if (start + size > blockSizes.at(current)){
+        //Blocks kept from before are reused when big enough.
+        current++;
+        if (current == blocks.size() || blockSizes.at(current) < size){
+            addBlock(size > BLOCK_SIZE ? size : BLOCK_SIZE);
+        }
+
+        //New blocks are aligned for any basic type.
+        start = 0;
+    }
+
+    offset = start + size;
+    return blocks.at(current) + start;
+}
+
+/**
+ * Frees everything in the arena at once. The
+ * blocks are kept for the next order.
+ */
+void OrderArena::reset(){
+    current = 0;
+    offset = 0;
+}
+
+/**
+ * Gets the number of bytes held by the arena.
+ * @return The size of every block added up.
+ */
+size_t OrderArena::getCapacity(){
+    size_t capacity = 0;
+    for (int i = 0; i < blockSizes.size(); i++){
+        capacity += blockSizes.at(i);
+    }
+
+    return capacity;
+}
+
+/**
+ * Adds a block after the current one.
+ * @param size The size of the block.
+ */
+void OrderArena::addBlock(size_t size){
+    blocks.insert(blocks.begin() + current, new char[size]);
+    blockSizes.insert(blockSizes.begin() + current, size);
+}
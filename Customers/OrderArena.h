@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderArena.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Bump allocator for everything that belongs to a single order. Orders,
+// sandwiches, substitutions and their lists are carved out of reused
+// blocks and all freed at once when the arena is reset.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_ORDERARENA_H
+#define SANDWICH_BAR_ORDERARENA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+class OrderArena {
+public:
+    /** Constructor/Destructor */
+    OrderArena();
+    ~OrderArena();
+
+    /** Allocation Methods */
+    void* allocate(size_t size, size_t alignment);
+    void reset();
+    size_t getCapacity();
+
+    /**
+     * Constructs an object inside the arena. The object
+     * must be destroyed in place before the arena is reset.
+     * @param args The arguments for the constructor.
+     * @return The new object.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args){
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+private:
+    /** Private Variables */
+    std::vector<char*> blocks;
+    std::vector<size_t> blockSizes;
+    int current;
+    size_t offset;
+
+    /** Block Constants */
+    const size_t BLOCK_SIZE = 4096;
+
+    /** Helper Methods */
+    void addBlock(size_t size);
+};
+
+/**
+ * Allocator that lets standard containers live in an
+ * arena. Memory is only released when the arena is reset.
+ * Without an arena it falls back to the heap, and copies
+ * always go to the heap so they can outlive the order.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    /** Constructors */
+    ArenaAllocator() : arena(NULL) { }
+    ArenaAllocator(OrderArena* arena) : arena(arena) { }
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) { }
+
+    /** Allocation Methods */
+    T* allocate(size_t count){
+        if (arena == NULL) return static_cast<T*>(::operator new(count * sizeof(T)));
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* item, size_t){
+        if (arena == NULL) ::operator delete(item);
+    }
+
+    /** Arena Methods */
+    OrderArena* getArena() const { return arena; }
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+private:
+    /** Private Variables */
+    OrderArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& first, const ArenaAllocator<U>& second){
+    return first.getArena() == second.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& first, const ArenaAllocator<U>& second){
+    return first.getArena() != second.getArena();
+}
+
+
+#endif //SANDWICH_BAR_ORDERARENA_H
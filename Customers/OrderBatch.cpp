@@ -0,0 +1,242 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderBatch.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Commits a whole batch of orders against the stock at once. Demand is
+// added up per ingredient in one pass and, when stock runs short, a
+// policy decides which orders are made.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "OrderBatch.h"
+
+using namespace std;
+
+const int OrderBatch::FIFO;
+const int OrderBatch::MAX_REVENUE;
+
+/**
+ * Orders batch entries so the most revenue comes first.
+ * @param first The first entry.
+ * @param second The second entry.
+ * @return Whether the first entry comes before the second.
+ */
+static bool compareRevenue(const BatchEntry& first, const BatchEntry& second){
+    return first.revenue > second.revenue;
+}
+
+/**
+ * Creates a batch that commits against a stock table.
+ * @param table The stock table to take from.
+ * @param policy Which orders win when stock runs short.
+ */
+OrderBatch::OrderBatch(StockTable* table, int policy){
+    this->table = table;
+    this->policy = policy;
+    made = 0;
+    revenue = 0;
+}
+
+/**
+ * Default destructor. The stock table is not owned.
+ */
+OrderBatch::~OrderBatch(){ }
+
+/**
+ * Commits a batch of orders. If the stock covers the
+ * whole batch every order is made. Otherwise the policy
+ * picks the orders to make: FIFO gives the same result as
+ * making them one at a time, while maximizing revenue also
+ * tries the most expensive orders first and keeps whichever
+ * earns more. The stock is taken in one step either way.
+ * @param orders The orders to commit.
+ * @return The number of orders made.
+ */
+int OrderBatch::commit(const vector<Order*>& orders){
+    if (demand.size() < table->getSize()){
+        demand.resize(table->getSize(), 0);
+        available.resize(table->getSize(), 0);
+    }
+    flatten(orders);
+
+    //Plan again if another thread takes stock before the commit.
+    do {
+        committed.clear();
+        if (fitsAll()){
+            outcomes.assign(orders.size(), true);
+            for (int i = 0; i < touched.size(); i++){
+                BillItem item;
+                item.slot = touched[i];
+                item.count = demand[touched[i]];
+                committed.push_back(item);
+            }
+        } else {
+            plan(orders);
+        }
+    } while (!table->make(committed));
+
+    //Clear the demand for the next batch.
+    for (int i = 0; i < touched.size(); i++){
+        demand[touched[i]] = 0;
+    }
+
+    made = 0;
+    revenue = 0;
+    for (int i = 0; i < orders.size(); i++){
+        if (!outcomes[i]) continue;
+
+        made++;
+        revenue += orders.at(i)->getTotalCost();
+    }
+
+    return made;
+}
+
+/**
+ * Sets which orders win when stock runs short.
+ * @param policy Either FIFO or MAX_REVENUE.
+ */
+void OrderBatch::setPolicy(int policy){
+    this->policy = policy;
+}
+
+/**
+ * Gets whether each order in the last batch was made.
+ * @return The outcomes in the same order as the batch.
+ */
+const vector<bool>& OrderBatch::getOutcomes(){
+    return outcomes;
+}
+
+/**
+ * Gets the number of orders made in the last batch.
+ * @return The number of orders made.
+ */
+int OrderBatch::getMade(){
+    return made;
+}
+
+/**
+ * Gets the revenue of the orders made in the last batch.
+ * @return The revenue.
+ */
+float OrderBatch::getRevenue(){
+    return revenue;
+}
+
+/**
+ * Flattens the bill of every order into one uncompacted
+ * bill and adds up the demand for each slot in one pass.
+ * @param orders The orders in the batch.
+ */
+void OrderBatch::flatten(const vector<Order*>& orders){
+    flat.clear();
+    offsets.clear();
+    touched.clear();
+
+    for (int i = 0; i < orders.size(); i++){
+        offsets.push_back(flat.getItems().size());
+        orders.at(i)->appendBill(flat);
+    }
+    offsets.push_back(flat.getItems().size());
+
+    const vector<BillItem>& items = flat.getItems();
+    for (int i = 0; i < items.size(); i++){
+        if (demand[items[i].slot] == 0 && items[i].count > 0) touched.push_back(items[i].slot);
+        demand[items[i].slot] += items[i].count;
+    }
+}
+
+/**
+ * Checks whether the stock covers the whole batch.
+ * @return Boolean indicating whether every order fits.
+ */
+bool OrderBatch::fitsAll(){
+    for (int i = 0; i < touched.size(); i++){
+        if (table->getQuantity(touched[i]) < demand[touched[i]]) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Picks the orders to make when the stock runs short.
+ * The greedy revenue order can lose to FIFO, so both
+ * are tried when maximizing revenue.
+ * @param orders The orders in the batch.
+ */
+void OrderBatch::plan(const vector<Order*>& orders){
+    startQuantity.clear();
+    for (int i = 0; i < touched.size(); i++){
+        startQuantity.push_back(table->getQuantity(touched[i]));
+    }
+
+    sequence.clear();
+    for (int i = 0; i < orders.size(); i++){
+        BatchEntry entry;
+        entry.order = i;
+        entry.revenue = orders.at(i)->getTotalCost();
+        sequence.push_back(entry);
+    }
+
+    float fifoRevenue = tryOrders();
+    if (policy != MAX_REVENUE) return;
+
+    //Keep the FIFO plan aside and try the best sellers first.
+    fifoOutcomes.swap(outcomes);
+    fifoCommitted.swap(committed);
+    stable_sort(sequence.begin(), sequence.end(), compareRevenue);
+
+    if (tryOrders() < fifoRevenue){
+        outcomes.swap(fifoOutcomes);
+        committed.swap(fifoCommitted);
+    }
+}
+
+/**
+ * Tries the orders in sequence, making each one that
+ * fits in what is left of the stock.
+ * @return The revenue of the orders that were made.
+ */
+float OrderBatch::tryOrders(){
+    outcomes.assign(sequence.size(), false);
+    committed.clear();
+    for (int i = 0; i < touched.size(); i++){
+        available[touched[i]] = startQuantity[i];
+    }
+
+    const vector<BillItem>& items = flat.getItems();
+    float total = 0;
+    for (int i = 0; i < sequence.size(); i++){
+        int first = offsets[sequence[i].order];
+        int last = offsets[sequence[i].order + 1];
+
+        //The bills are uncompacted so take as we go and roll back on a shortfall.
+        int j = first;
+        for (; j < last; j++){
+            available[items[j].slot] -= items[j].count;
+            if (available[items[j].slot] < 0) break;
+        }
+        if (j < last){
+            for (; j >= first; j--){
+                available[items[j].slot] += items[j].count;
+            }
+            continue;
+        }
+
+        outcomes[sequence[i].order] = true;
+        total += sequence[i].revenue;
+    }
+
+    //Only the stock the chosen orders use is taken.
+    for (int i = 0; i < touched.size(); i++){
+        BillItem item;
+        item.slot = touched[i];
+        item.count = startQuantity[i] - available[touched[i]];
+        if (item.count > 0) committed.push_back(item);
+    }
+
+    return total;
+}
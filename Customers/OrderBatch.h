@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderBatch.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Commits a whole batch of orders against the stock at once. Demand is
+// added up per ingredient in one pass and, when stock runs short, a
+// policy decides which orders are made.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_ORDERBATCH_H
+#define SANDWICH_BAR_ORDERBATCH_H
+
+#include <vector>
+#include "Order.h"
+#include "../FoodItems/BillOfMaterials.h"
+#include "../FoodItems/StockTable.h"
+
+struct BatchEntry {
+    int order;
+    float revenue;
+};
+
+class OrderBatch {
+public:
+    /** Policies */
+    static const int FIFO = 0;
+    static const int MAX_REVENUE = 1;
+
+    /** Constructor/Destructor */
+    OrderBatch(StockTable* table, int policy);
+    ~OrderBatch();
+
+    /** Commit Methods */
+    int commit(const std::vector<Order*>& orders);
+    void setPolicy(int policy);
+
+    /** Result Methods */
+    const std::vector<bool>& getOutcomes();
+    int getMade();
+    float getRevenue();
+
+private:
+    /** Private Variables */
+    StockTable* table;
+    int policy;
+    std::vector<bool> outcomes;
+    int made;
+    float revenue;
+
+    /** Flattened Bills */
+    BillOfMaterials flat;
+    std::vector<int> offsets;
+    std::vector<int> demand;
+    std::vector<int> available;
+    std::vector<int> touched;
+    std::vector<int> startQuantity;
+    std::vector<BatchEntry> sequence;
+    std::vector<BillItem> committed;
+    std::vector<bool> fifoOutcomes;
+    std::vector<BillItem> fifoCommitted;
+
+    /** Helper Methods */
+    void flatten(const std::vector<Order*>& orders);
+    bool fitsAll();
+    void plan(const std::vector<Order*>& orders);
+    float tryOrders();
+};
+
+
+#endif //SANDWICH_BAR_ORDERBATCH_H
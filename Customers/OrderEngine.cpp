@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderEngine.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Processes orders on a pool of worker threads. Any number of
+// registers can submit orders at once and collect the completed
+// orders afterwards. Stock is reserved through the inventory.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OrderEngine.h"
+
+using namespace std;
+
+/**
+ * Creates the engine and starts the workers. Every recipe
+ * bill is compiled up front so workers only read the recipes.
+ * The catalog must not change while the engine is running.
+ * @param inventory The inventory to reserve stock from.
+ * @param recipes The recipes the orders can use.
+ * @param numWorkers The number of worker threads.
+ */
+OrderEngine::OrderEngine(Inventory* inventory, RecipeCatalog* recipes, int numWorkers){
+    this->inventory = inventory;
+    inFlight = 0;
+    stopping = false;
+    made = 0;
+    failed = 0;
+
+    //Compile the recipes before any worker reads them.
+    for (int i = 0; i < recipes->getSize(); i++){
+        recipes->getRecipe(i)->getBill();
+    }
+
+    if (numWorkers < 1) numWorkers = 1;
+    for (int i = 0; i < numWorkers; i++){
+        workers.push_back(thread(&OrderEngine::work, this));
+    }
+}
+
+/**
+ * Stops the workers. Orders that were never collected
+ * are left to the caller that submitted them.
+ */
+OrderEngine::~OrderEngine(){
+    stop();
+}
+
+/**
+ * Submits an order to be made. Safe to call from
+ * several threads. The engine does not own the order.
+ * @param order The order to make.
+ * @return Boolean indicating whether the order was accepted.
+ */
+bool OrderEngine::submit(Order* order){
+    OrderResult entry;
+    entry.order = order;
+    entry.compact = NULL;
+    entry.made = false;
+    return enqueue(entry);
+}
+
+/**
+ * Submits a compact order to be made. Safe to call from
+ * several threads. The engine does not own the order.
+ * @param order The order to make.
+ * @return Boolean indicating whether the order was accepted.
+ */
+bool OrderEngine::submit(CompactOrder* order){
+    OrderResult entry;
+    entry.order = NULL;
+    entry.compact = order;
+    entry.made = false;
+    return enqueue(entry);
+}
+
+/**
+ * Takes a completed order from the engine.
+ * @param result Gets the order and whether it was made.
+ * @param wait Whether to wait for an order to complete.
+ * @return Boolean indicating whether a result was taken.
+ */
+bool OrderEngine::takeCompleted(OrderResult* result, bool wait){
+    unique_lock<mutex> guard(engineLock);
+    if (wait){
+        while (completed.empty() && inFlight > completed.size()){
+            completedReady.wait(guard);
+        }
+    }
+
+    if (completed.empty()) return false;
+
+    *result = completed.front();
+    completed.pop_front();
+    inFlight--;
+
+    return true;
+}
+
+/**
+ * Waits until every submitted order has been processed.
+ * The results stay available to takeCompleted.
+ */
+void OrderEngine::drain(){
+    unique_lock<mutex> guard(engineLock);
+    while (inFlight > completed.size()){
+        completedReady.wait(guard);
+    }
+}
+
+/**
+ * Stops the workers once the pending orders are processed.
+ * Orders submitted afterwards are rejected.
+ */
+void OrderEngine::stop(){
+    {
+        lock_guard<mutex> guard(engineLock);
+        if (stopping) return;
+        stopping = true;
+    }
+
+    pendingReady.notify_all();
+    for (int i = 0; i < workers.size(); i++){
+        workers.at(i).join();
+    }
+}
+
+/**
+ * Gets the number of orders that were made.
+ * @return The number of orders made.
+ */
+long long OrderEngine::getMade(){
+    lock_guard<mutex> guard(engineLock);
+    return made;
+}
+
+/**
+ * Gets the number of orders that ran out of stock.
+ * @return The number of orders that failed.
+ */
+long long OrderEngine::getFailed(){
+    lock_guard<mutex> guard(engineLock);
+    return failed;
+}
+
+/**
+ * Places an order on the pending queue. Orders are
+ * turned away once the engine is stopping since no
+ * worker would be left to make them.
+ * @param entry The order waiting to be made.
+ * @return Boolean indicating whether the order was queued.
+ */
+bool OrderEngine::enqueue(const OrderResult& entry){
+    {
+        lock_guard<mutex> guard(engineLock);
+        if (stopping) return false;
+
+        pending.push_back(entry);
+        inFlight++;
+    }
+
+    pendingReady.notify_one();
+    return true;
+}
+
+/**
+ * Worker loop. Takes orders off the pending queue, reserves
+ * their stock and places them on the completed queue.
+ */
+void OrderEngine::work(){
+    while (true){
+        OrderResult result;
+        {
+            unique_lock<mutex> guard(engineLock);
+            while (pending.empty() && !stopping){
+                pendingReady.wait(guard);
+            }
+            if (pending.empty()) return;
+
+            result = pending.front();
+            pending.pop_front();
+        }
+
+        //The inventory handles its own locking.
+        if (result.compact != NULL) result.made = inventory->reserve(result.compact);
+        else result.made = inventory->reserve(result.order);
+
+        {
+            lock_guard<mutex> guard(engineLock);
+            completed.push_back(result);
+            if (result.made) made++;
+            else failed++;
+        }
+
+        completedReady.notify_all();
+    }
+}
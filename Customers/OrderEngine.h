@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderEngine.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Processes orders on a pool of worker threads. Any number of
+// registers can submit orders at once and collect the completed
+// orders afterwards. Stock is reserved through the inventory.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_ORDERENGINE_H
+#define SANDWICH_BAR_ORDERENGINE_H
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Order.h"
+#include "CompactOrder.h"
+#include "../Capital/RecipeCatalog.h"
+#include "../FoodItems/Inventory.h"
+
+struct OrderResult {
+    Order* order;
+    CompactOrder* compact;
+    bool made;
+};
+
+class OrderEngine {
+public:
+    /** Constructor/Destructor */
+    OrderEngine(Inventory* inventory, RecipeCatalog* recipes, int numWorkers);
+    ~OrderEngine();
+
+    /** Order Operations */
+    bool submit(Order* order);
+    bool submit(CompactOrder* order);
+    bool takeCompleted(OrderResult* result, bool wait);
+    void drain();
+    void stop();
+
+    /** Statistic Methods */
+    long long getMade();
+    long long getFailed();
+
+private:
+    /** Private Variables */
+    Inventory* inventory;
+    std::vector<std::thread> workers;
+    std::deque<OrderResult> pending;
+    std::deque<OrderResult> completed;
+    std::mutex engineLock;
+    std::condition_variable pendingReady;
+    std::condition_variable completedReady;
+    int inFlight;
+    bool stopping;
+    long long made;
+    long long failed;
+
+    /** Helper Methods */
+    bool enqueue(const OrderResult& entry);
+    void work();
+};
+
+
+#endif //SANDWICH_BAR_ORDERENGINE_H
@@ -22,6 +22,7 @@ Sandwich::Sandwich(Recipe* current){
     //Creates a recipe with NO substitution.
     baseRecipe = current;
     subList = NULL;
+    arena = NULL;
 }
 
 /**
@@ -34,6 +35,20 @@ Sandwich::Sandwich(Recipe* current, Substitution* subs){
     //Creates a recipe with substitution.
     baseRecipe = current;
     subList = subs;
+    arena = NULL;
+}
+
+/**
+ * Constructor that creates a sandwich inside an order
+ * arena. The substitution must be in the same arena.
+ * @param current The recipe to be based on.
+ * @param subs The substitution or NULL for none.
+ * @param arena The arena holding the order.
+ */
+Sandwich::Sandwich(Recipe* current, Substitution* subs, OrderArena* arena){
+    baseRecipe = current;
+    subList = subs;
+    this->arena = arena;
 }
 
 /**
@@ -41,8 +56,10 @@ Sandwich::Sandwich(Recipe* current, Substitution* subs){
  */
 Sandwich::~Sandwich(){
     //Check if we have a null subList.
-    if (subList != NULL)
+    if (subList != NULL && arena == NULL)
         delete subList;
+    else if (subList != NULL)
+        subList->~Substitution();
     subList = NULL;
 }
 
@@ -52,24 +69,15 @@ Sandwich::~Sandwich(){
  * @return Boolean indicating whether we can make.
  */
 bool Sandwich::canMake(){
-    //We iterate through the ingredients.
-    bool canMake;
-    if (subList != NULL){
-        canMake = baseRecipe->canMake(subList->getRemovals());
-    } else {
-        canMake = baseRecipe->canMake();
-    }
-    if (!canMake) return false;
+    //Without a substitution the compiled recipe bill is enough.
+    if (subList == NULL) return baseRecipe->canMake();
 
-    //Check additions.
-    if (subList != NULL){
-        vector<Ingredient*> additions = subList->getAdditions();
-        for (int i = 0; i < additions.size(); i++){
-            if (additions.at(i)->canUse() == false) return false;
-        }
-    }
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(bill);
+    bill.compact();
 
-    return true;
+    return bill.canMake();
 }
 
 /**
@@ -78,25 +86,37 @@ bool Sandwich::canMake(){
  * @return Whether the sandwich was made.
  */
 bool Sandwich::make(){
-    //Check if we can make it.
-    if (!canMake()) return false;
+    //Without a substitution the compiled recipe bill is enough.
+    if (subList == NULL) return baseRecipe->make();
 
-    //Now, we make the base recipe.
-    if (subList != NULL){
-        baseRecipe->make(subList->getRemovals());
-    } else {
-        baseRecipe->make();
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    appendBill(bill);
+    bill.compact();
+
+    return bill.make();
+}
+
+/**
+ * Adds the simple ingredients needed for this sandwich
+ * to a bill of materials. Applies the substitution.
+ * The bill is left uncompacted.
+ * @param bill The bill to add to.
+ */
+void Sandwich::appendBill(BillOfMaterials& bill){
+    if (subList == NULL){
+        bill.addBill(baseRecipe->getBill());
+        return;
     }
 
+    //Base recipe without the removals.
+    baseRecipe->appendBill(subList->getRemovals(), bill);
+
     //Apply the additions.
-    if (subList != NULL){
-        vector<Ingredient*> additions = subList->getAdditions();
-        for (int i = 0; i < additions.size(); i++){
-            additions.at(i)->useIngredient();
-        }
+    const IngredientList& additions = subList->getAdditions();
+    for (int i = 0; i < additions.size(); i++){
+        additions.at(i)->appendBill(bill, 1);
     }
-
-    return true;
 }
 
 /**
@@ -118,8 +138,8 @@ float Sandwich::getTotalCost(){
  * Gets the referenced recipe of the sandwich.
  * @return The recipe.
  */
-Recipe Sandwich::getRecipe(){
-    return *baseRecipe;
+Recipe* Sandwich::getRecipe(){
+    return baseRecipe;
 }
 
 /**
@@ -135,15 +155,11 @@ bool Sandwich::hasSubstitution(){
 }
 
 /**
- * Gets the substitution or creates an empty one.
- * @return The substitution of the sandwich.
+ * Gets the substitution of the sandwich.
+ * @return The substitution or NULL if there is none.
  */
-Substitution Sandwich::getSubstitution(){
-    if (subList == NULL){
-        return Substitution();
-    }
-
-    return *subList;
+Substitution* Sandwich::getSubstitution(){
+    return subList;
 }
 
 /**
@@ -20,17 +20,21 @@ public:
     /** Constructor/Destructor */
     Sandwich(Recipe* current);
     Sandwich(Recipe* current, Substitution* subs);
+    Sandwich(Recipe* current, Substitution* subs, OrderArena* arena);
     ~Sandwich();
 
     /** Make Operations */
     bool canMake();
     bool make();
 
+    /** Bill Methods */
+    void appendBill(BillOfMaterials& bill);
+
     /** Sandwich Operations */
     float getTotalCost();
-    Recipe getRecipe();
+    Recipe* getRecipe();
     bool hasSubstitution();
-    Substitution getSubstitution();
+    Substitution* getSubstitution();
 
     /** Print Methods */
     std::string print();
@@ -39,6 +43,7 @@ private:
     /** Private Variables */
     Recipe* baseRecipe;
     Substitution* subList;
+    OrderArena* arena;
     float totalCost;
 };
 
@@ -16,11 +16,15 @@ using namespace std;
  * Creates a new substitution with
  * empty vectors.
  */
-Substitution::Substitution(){
-    //Creates empty vectors to hold ingredients.
-    additions = vector<Ingredient*>();
-    removals = vector<Ingredient*>();
-}
+Substitution::Substitution(){ }
+
+/**
+ * Creates a new substitution whose lists
+ * live in an order arena.
+ * @param arena The arena holding the order.
+ */
+Substitution::Substitution(OrderArena* arena)
+    : additions(ArenaAllocator<Ingredient*>(arena)), removals(ArenaAllocator<Ingredient*>(arena)) { }
 
 /**
  * Creates a substitution with specified
@@ -30,8 +34,8 @@ Substitution::Substitution(){
  */
 Substitution::Substitution(std::vector<Ingredient*> add, std::vector<Ingredient*> remove){
     //Creates vectors to hold the substitution values.
-    additions = add;
-    removals = remove;
+    additions.assign(add.begin(), add.end());
+    removals.assign(remove.begin(), remove.end());
 }
 
 /**
@@ -115,7 +119,7 @@ string Substitution::printSubstitution(){
  * Gets the additions.
  * @return A vector of additions.
  */
-std::vector<Ingredient*> Substitution::getAdditions(){
+const IngredientList& Substitution::getAdditions(){
     return additions;
 }
 
@@ -123,7 +127,7 @@ std::vector<Ingredient*> Substitution::getAdditions(){
  * Gets the removals
  * @return A vector of removals.
  */
-std::vector<Ingredient*> Substitution::getRemovals(){
+const IngredientList& Substitution::getRemovals(){
     return removals;
 }
 
@@ -132,7 +136,7 @@ std::vector<Ingredient*> Substitution::getRemovals(){
  * @param list The list of ingredients to calculate.
  * @return The total cost.
  */
-float Substitution::calculateCost(vector<Ingredient*> list){
+float Substitution::calculateCost(const IngredientList& list){
     float total = 0;
     for (int i = 0; i < list.size(); i++){
         total += list.at(i)->getCost();
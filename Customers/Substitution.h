@@ -14,11 +14,15 @@
 #include <string>
 #include <vector>
 #include "../FoodItems/Ingredient.h"
+#include "OrderArena.h"
+
+typedef std::vector<Ingredient*, ArenaAllocator<Ingredient*> > IngredientList;
 
 class Substitution {
 public:
     /** Constructor/Destructor */
     Substitution();
+    Substitution(OrderArena* arena);
     Substitution(std::vector<Ingredient*> add, std::vector<Ingredient*> remove);
     ~Substitution();
 
@@ -34,16 +38,16 @@ public:
     std::string printSubstitution();
 
     /** Get Operations */
-    std::vector<Ingredient*> getAdditions();
-    std::vector<Ingredient*> getRemovals();
+    const IngredientList& getAdditions();
+    const IngredientList& getRemovals();
 
 private:
     /** Private Variables */
-    std::vector<Ingredient*> additions;
-    std::vector<Ingredient*> removals;
+    IngredientList additions;
+    IngredientList removals;
 
     /** Helper Methods */
-    float calculateCost(std::vector<Ingredient*> list);
+    float calculateCost(const IngredientList& list);
 };
 
 
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// BillOfMaterials.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Flat list of the stock table slots needed to make something
+// along with how many of each are needed. Recipes and complex
+// ingredients compile themselves down into one of these.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <climits>
+#include "BillOfMaterials.h"
+#include "SimpleIngredient.h"
+#include "StockTable.h"
+
+using namespace std;
+
+/**
+ * Orders bill items so that duplicates end up next to each other.
+ * @param first The first bill item.
+ * @param second The second bill item.
+ * @return Whether the first item comes before the second.
+ */
+static bool compareItems(const BillItem& first, const BillItem& second){
+    return first.slot < second.slot;
+}
+
+/**
+ * Creates an empty bill.
+ */
+BillOfMaterials::BillOfMaterials(){
+    table = NULL;
+}
+
+/**
+ * Default destructor. The stock table is not owned.
+ */
+BillOfMaterials::~BillOfMaterials(){ }
+
+/**
+ * Adds a requirement to the bill. Duplicates are
+ * allowed until the bill is compacted.
+ * @param ingredient The simple ingredient needed.
+ * @param count How many instances are needed.
+ */
+void BillOfMaterials::addItem(SimpleIngredient* ingredient, int count){
+    BillItem item;
+    item.slot = ingredient->getSlot();
+    item.count = count;
+
+    items.push_back(item);
+    table = ingredient->getTable();
+}
+
+/**
+ * Adds every requirement of another bill to this one.
+ * @param other The bill to add.
+ */
+void BillOfMaterials::addBill(const BillOfMaterials& other){
+    items.insert(items.end(), other.items.begin(), other.items.end());
+    if (other.table != NULL) table = other.table;
+}
+
+/**
+ * Sorts the bill and merges duplicate ingredients
+ * so each ingredient appears exactly once.
+ */
+void BillOfMaterials::compact(){
+    if (items.size() < 2) return;
+    sort(items.begin(), items.end(), compareItems);
+
+    //Merge runs of the same ingredient.
+    int last = 0;
+    for (int i = 1; i < items.size(); i++){
+        if (items[i].slot == items[last].slot){
+            items[last].count += items[i].count;
+        } else {
+            items[++last] = items[i];
+        }
+    }
+    items.resize(last + 1);
+}
+
+/**
+ * Removes all requirements from the bill.
+ */
+void BillOfMaterials::clear(){
+    items.clear();
+    table = NULL;
+}
+
+/**
+ * Checks whether there is enough stock for every
+ * requirement in the bill.
+ * @return Boolean indicating whether the bill can be made.
+ */
+bool BillOfMaterials::canMake() const {
+    if (table == NULL) return true;
+    return table->canMake(*this);
+}
+
+/**
+ * Uses up the stock for every requirement in the bill.
+ * Nothing is used unless the whole bill can be made.
+ * @return Boolean indicating success.
+ */
+bool BillOfMaterials::make() const {
+    if (table == NULL) return true;
+    return table->make(*this);
+}
+
+/**
+ * Gets the compiled list of requirements.
+ * @return The requirements in the bill.
+ */
+const vector<BillItem>& BillOfMaterials::getItems() const {
+    return items;
+}
+
+/**
+ * Gets the stock table the bill was built against.
+ * @return The stock table or NULL for an empty bill.
+ */
+StockTable* BillOfMaterials::getTable() const {
+    return table;
+}
+
+/**
+ * Gets how many times the bill could be made with
+ * the current stock.
+ * @return The number of times the bill can be made.
+ */
+int BillOfMaterials::getMakeable() const {
+    if (table == NULL) return INT_MAX;
+    return table->getMakeable(*this);
+}
@@ -0,0 +1,53 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// BillOfMaterials.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Flat list of the stock table slots needed to make something
+// along with how many of each are needed. Recipes and complex
+// ingredients compile themselves down into one of these.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_BILLOFMATERIALS_H
+#define SANDWICH_BAR_BILLOFMATERIALS_H
+
+#include <vector>
+
+class SimpleIngredient;
+class StockTable;
+
+struct BillItem {
+    int slot;
+    int count;
+};
+
+class BillOfMaterials {
+public:
+    /** Constructor/Destructor */
+    BillOfMaterials();
+    ~BillOfMaterials();
+
+    /** Build Methods */
+    void addItem(SimpleIngredient* ingredient, int count);
+    void addBill(const BillOfMaterials& other);
+    void compact();
+    void clear();
+
+    /** Make Methods */
+    bool canMake() const;
+    bool make() const;
+
+    /** Get Methods */
+    const std::vector<BillItem>& getItems() const;
+    StockTable* getTable() const;
+    int getMakeable() const;
+
+private:
+    /** Private Variables */
+    std::vector<BillItem> items;
+    StockTable* table;
+};
+
+
+#endif //SANDWICH_BAR_BILLOFMATERIALS_H
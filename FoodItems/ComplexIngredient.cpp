@@ -9,7 +9,6 @@
 // relies on the simple ingredient to operate.
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <climits>
 #include "ComplexIngredient.h"
 
 using namespace std;
@@ -20,14 +19,20 @@ using namespace std;
  * @param name The name of the ingredient.
  * @param premium The ingredient premium.
  * @param basedOn A vector indicating the ingredient base.
+ * @param index The reference index of the bar.
  */
-ComplexIngredient::ComplexIngredient(string name, float premium, vector<Ingredient*>* basedOn) : Ingredient(name) {
+ComplexIngredient::ComplexIngredient(string name, float premium, vector<Ingredient*>* basedOn,
+                                     ReferenceIndex* index) : Ingredient(name, index) {
     //First, set the premium price.
     this->premium = premium;
     this->basedOn = basedOn;
+    billCompiled = false;
+    costCached = false;
 
-    //Manages the references.
-    manageReferences();
+    //Records what this ingredient uses.
+    for (int i = 0; i < basedOn->size(); i++){
+        addReference(basedOn->at(i));
+    }
 }
 
 /**
@@ -71,36 +76,30 @@ void ComplexIngredient::orderMore(int amount) {
 
 /**
  * Gets the cost of the ingredient based on
- * the premium and sub-ingredient costs.
+ * the premium and sub-ingredient costs. The
+ * cost is kept until the ingredient is invalidated.
  * @return The cost of the ingredient.
  */
 float ComplexIngredient::getCost(){
-    float cost = premium;
+    if (costCached) return cost;
+    cost = premium;
 
     //Iterate through all other ingredients and get their cost.
     for (int i = 0; i < basedOn->size(); i++){
         cost += basedOn->at(i)->getCost();
     }
 
+    costCached = true;
     return cost;
 }
 
 /**
  * Gets the number of instances of this ingredient.
+ * Limited by the scarcest simple ingredient it uses.
  * @return The number of instances.
  */
 int ComplexIngredient::getQuantity() {
-    int lowestItem = INT_MAX;
-
-    //Loops through all base items.
-    for (int i = 0; i < basedOn->size(); i++){
-        int currentItem = basedOn->at(i)->getQuantity();
-
-        if (currentItem < lowestItem)
-            lowestItem = currentItem;
-    }
-
-    return lowestItem;
+    return getBill().getMakeable();
 }
 
 /**
@@ -108,34 +107,60 @@ int ComplexIngredient::getQuantity() {
  * @return Boolean indicating whether we can use it.
  */
 bool ComplexIngredient::canUse(){
-    for (int i = 0; i < basedOn->size(); i++){
-        if (basedOn->at(i)->getQuantity() <= 0) {
-            return false;
-        }
-    }
-
-    return true;
+    return getBill().canMake();
 }
 
 /**
  * Uses the ingredient by decrimenting the number of instances.
+ * Nothing is used unless every sub-ingredient is available.
  * @return Boolean indicating whether it was used.
  */
 bool ComplexIngredient::useIngredient(){
-    //First, we need to perform a sanity check.
-    bool valid = true;
+    return getBill().make();
+}
+
+/**
+ * Adds the simple ingredients this ingredient is
+ * made of to a bill of materials.
+ * @param bill The bill to add to.
+ * @param count How many instances are needed.
+ */
+void ComplexIngredient::appendBill(BillOfMaterials& bill, int count){
     for (int i = 0; i < basedOn->size(); i++){
-        if (basedOn->at(i)->canUse() == false){
-            return false;
-        }
+        basedOn->at(i)->appendBill(bill, count);
     }
+}
 
-    //Otherwise, decrement all quantities.
-    for (int i = 0; i < basedOn->size(); i++){
-        basedOn->at(i)->useIngredient();
+/**
+ * Gets the compiled bill for one instance of this
+ * ingredient. Compiles it on first use.
+ * @return The compiled bill of materials.
+ */
+const BillOfMaterials& ComplexIngredient::getBill(){
+    if (!billCompiled){
+        compiledBill.clear();
+        appendBill(compiledBill, 1);
+        compiledBill.compact();
+        billCompiled = true;
     }
 
-    return true;
+    return compiledBill;
+}
+
+/**
+ * Gets the premium charged on top of the sub-ingredients.
+ * @return The ingredient premium.
+ */
+float ComplexIngredient::getPremium(){
+    return premium;
+}
+
+/**
+ * Gets the ingredients this ingredient is made of.
+ * @return The sub-ingredients.
+ */
+const vector<Ingredient*>& ComplexIngredient::getBasedOn(){
+    return *basedOn;
 }
 
 /**
@@ -163,15 +188,11 @@ string ComplexIngredient::printDetails() {
     return text;
 }
 
-void ComplexIngredient::updateReferences(std::vector<Food*> references){
-    //First, passes the references to the update function.
-    addReferences(references);
-
-    //Add ourselves to the current reference list.
-    references.push_back(this);
-
-    //Now, we go through the references and update them.
-    for (int i = 0; i < basedOn->size(); i++){
-        basedOn->at(i)->updateReferences(references);
-    }
+/**
+ * Drops the compiled bill and cost so they are
+ * rebuilt on next use.
+ */
+void ComplexIngredient::invalidate(){
+    billCompiled = false;
+    costCached = false;
 }
\ No newline at end of file
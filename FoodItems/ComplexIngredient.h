@@ -18,7 +18,7 @@ class ComplexIngredient : public Ingredient {
 public:
     /** Constructor/Destructor */
     ComplexIngredient(std::string name,
-                      float premium, std::vector<Ingredient*>* basedOn);
+                      float premium, std::vector<Ingredient*>* basedOn, ReferenceIndex* index);
     virtual ~ComplexIngredient();
 
     /** Recipe Operations */
@@ -28,16 +28,28 @@ public:
     virtual bool canUse();
     virtual bool useIngredient();
 
+    /** Bill Methods */
+    virtual void appendBill(BillOfMaterials& bill, int count);
+    const BillOfMaterials& getBill();
+
+    /** Structure Methods */
+    float getPremium();
+    const std::vector<Ingredient*>& getBasedOn();
+
     /** Print Methods */
     virtual std::string printDetails();
 
     /** Update Method */
-    void updateReferences(std::vector<Food*> references);
+    void invalidate();
 
 private:
     /** Private Variables */
     float premium;
     std::vector<Ingredient*>* basedOn;
+    BillOfMaterials compiledBill;
+    bool billCompiled;
+    float cost;
+    bool costCached;
 };
 
 
@@ -15,20 +15,57 @@
 using namespace std;
 
 /**
- * Empty destructor.
+ * Destructor which takes the item out of the
+ * reference index.
  */
-Food::~Food(){ }
+Food::~Food(){
+    index->removeFood(id);
+}
+
+/**
+ * Constructor which adds the item to the
+ * reference index of its bar.
+ * @param index The index the item belongs to.
+ */
+Food::Food(ReferenceIndex* index){
+    this->index = index;
+    id = index->addFood(this);
+}
 
 /**
- * Constructor which creates a blank referenced
- * by list.
+ * Gets the id of the food item in the reference index.
+ * @return The id of the food item.
  */
-Food::Food(){
-    referencedBy = vector<Food*>();
+int Food::getId(){
+    return id;
 }
 
-void Food::manageReferences(){
-    updateReferences(vector<Food*>());
+/**
+ * Gets the index holding the references of every
+ * food item in the same bar.
+ * @return The reference index.
+ */
+ReferenceIndex* Food::getIndex(){
+    return index;
+}
+
+/**
+ * Drops anything cached from the structure of this
+ * food item. Does nothing by default.
+ */
+void Food::invalidate(){ }
+
+/**
+ * Invalidates every food item that references this one,
+ * directly or through other items.
+ */
+void Food::invalidateReferences(){
+    index->markChanged();
+
+    vector<Food*> referencedBy = getReferences();
+    for (int i = 0; i < referencedBy.size(); i++){
+        referencedBy.at(i)->invalidate();
+    }
 }
 
 /**
@@ -36,7 +73,7 @@ void Food::manageReferences(){
  * @return A vector with all food refererences.
  */
 vector<Food*> Food::getReferences(){
-    return referencedBy;
+    return index->getAllReferences(id);
 }
 
 /**
@@ -45,6 +82,7 @@ vector<Food*> Food::getReferences(){
  * @return String containing the references.
  */
 string Food::printReferences(){
+    vector<Food*> referencedBy = getReferences();
     if (referencedBy.size() == 0) return "None";
     string text = "{";
 
@@ -60,19 +98,10 @@ string Food::printReferences(){
     return text;
 }
 
-void Food::addReferences(std::vector<Food*> references){
-    //Check if we have duplicates.
-    for (int i = 0; i < references.size(); i++){
-        bool dup = false;
-
-        for (int j = 0; j < referencedBy.size(); j++){
-            if (referencedBy.at(j) == references.at(i)) {
-                dup = true;
-                break;
-            }
-        }
-
-        //Adds in the current entry if no duplicates.
-        if (dup == false) referencedBy.push_back(references.at(i));
-    }
+/**
+ * Records that this food item uses another one.
+ * @param item The food item being used.
+ */
+void Food::addReference(Food* item){
+    index->addReference(item->id, id);
 }
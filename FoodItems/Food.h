@@ -14,6 +14,7 @@
 
 #include <vector>
 #include <string>
+#include "ReferenceIndex.h"
 
 class Food {
 public:
@@ -22,22 +23,27 @@ public:
 
     /** Print Methods */
     virtual std::string getName() = 0;
+    int getId();
 
     /** Update Method */
-    virtual void updateReferences(std::vector<Food*> references) = 0;
+    virtual void invalidate();
+    void invalidateReferences();
+
+    /** Reference Methods */
+    ReferenceIndex* getIndex();
 protected:
     /** Constructor */
-    Food();
+    Food(ReferenceIndex* index);
 
     /** Helper Methods */
-    void manageReferences();
+    void addReference(Food* item);
     std::vector<Food*> getReferences();
     std::string printReferences();
-    void addReferences(std::vector<Food*> references);
 
 private:
     /** Private Variables */
-    std::vector<Food*> referencedBy;
+    int id;
+    ReferenceIndex* index;
 };
 
 
@@ -32,8 +32,9 @@ string Ingredient::getName(){
 /**
  * Constructor which sets the name of the ingredient.
  * @param name The name of the ingredient.
+ * @param index The reference index of the bar.
  */
-Ingredient::Ingredient(string name) : commonName(name) {
+Ingredient::Ingredient(string name, ReferenceIndex* index) : Food(index), commonName(name) {
     //Used for testing Grok functionality.
     SandwichBar::numItems++;
 };
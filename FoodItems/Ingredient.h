@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include "Food.h"
+#include "BillOfMaterials.h"
 
 class Ingredient : public Food {
 public:
@@ -28,16 +29,16 @@ public:
     virtual bool useIngredient() = 0;
     virtual bool canUse() = 0;
 
+    /** Bill Methods */
+    virtual void appendBill(BillOfMaterials& bill, int count) = 0;
+
     /** Print Methods */
     virtual std::string printDetails() = 0;
     std::string getName();
 
-    /** Update Method */
-    virtual void updateReferences(std::vector<Food*> references) = 0;
-
 protected:
     /** Constructor */
-    Ingredient(std::string name);
+    Ingredient(std::string name, ReferenceIndex* index);
 
     /** Pringt Methods */
     std::string printHeader();
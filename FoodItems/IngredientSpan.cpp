@@ -0,0 +1,44 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IngredientSpan.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Read-only view of a list of ingredients that can be chained onto
+// another view. Lets removal lists be passed down a recipe without
+// copying them into a new vector.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "IngredientSpan.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an empty view.
+ */
+IngredientSpan::IngredientSpan() : items(NULL), count(0), next(NULL) { }
+
+/**
+ * Checks whether the view and every view chained
+ * after it are empty.
+ * @return Boolean indicating whether there are no items.
+ */
+bool IngredientSpan::empty() const {
+    if (count > 0) return false;
+
+    return next == NULL || next->empty();
+}
+
+/**
+ * Checks whether an ingredient is in the view or
+ * any view chained after it.
+ * @param item The ingredient to look for.
+ * @return Boolean indicating whether it was found.
+ */
+bool IngredientSpan::contains(const Ingredient* item) const {
+    for (int i = 0; i < count; i++){
+        if (items[i] == item) return true;
+    }
+
+    return next != NULL && next->contains(item);
+}
@@ -0,0 +1,37 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IngredientSpan.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Read-only view of a list of ingredients that can be chained onto
+// another view. Lets removal lists be passed down a recipe without
+// copying them into a new vector.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_INGREDIENTSPAN_H
+#define SANDWICH_BAR_INGREDIENTSPAN_H
+
+#include <cstddef>
+#include <vector>
+
+class Ingredient;
+
+struct IngredientSpan {
+    Ingredient* const* items;
+    int count;
+    const IngredientSpan* next;
+
+    /** Constructors */
+    IngredientSpan();
+    template <typename Alloc>
+    IngredientSpan(const std::vector<Ingredient*, Alloc>& list)
+        : items(list.data()), count(list.size()), next(NULL) { }
+
+    /** Check Methods */
+    bool empty() const;
+    bool contains(const Ingredient* item) const;
+};
+
+
+#endif //SANDWICH_BAR_INGREDIENTSPAN_H
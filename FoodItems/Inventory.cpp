@@ -12,16 +12,33 @@
 #include "Inventory.h"
 #include "SimpleIngredient.h"
 #include "ComplexIngredient.h"
+#include "../Customers/Order.h"
+#include "../Customers/CompactOrder.h"
 
 using namespace std;
 
 /**
  * Constructor which creates an
- * empty pantry.
+ * empty pantry with its own
+ * reference index.
  */
 Inventory::Inventory(){
-    //Create the pantry.
-    pantry = new vector<Ingredient*>();
+    index = new ReferenceIndex();
+    ownsIndex = true;
+    createPantry();
+}
+
+/**
+ * Constructor which creates an empty
+ * pantry sharing the reference index
+ * of a bar. The index must outlive
+ * the inventory and its recipes.
+ * @param index The reference index of the bar.
+ */
+Inventory::Inventory(ReferenceIndex* index){
+    this->index = index;
+    ownsIndex = false;
+    createPantry();
 }
 
 /**
@@ -34,24 +51,34 @@ Inventory::~Inventory(){
         delete pantry->at(i);
 
     delete pantry;
+    delete pantryIndex;
+    delete slotNames;
+    delete stock;
+    if (ownsIndex) delete index;
 }
 
 /**
  * Adds a new simple ingredient to the pantry.
+ * Fails if an ingredient with that name already exists.
  * @param name The name of the ingredient.
  * @param quantity The quantity of the ingredient.
  * @param cost The cost of the ingredient.
  * @return Boolean indicating success.
  */
 bool Inventory::addSimpleIngredient(string name, int quantity, float cost){
-    Ingredient* simple = new SimpleIngredient(name, quantity, cost);
-    pantry->push_back(simple);
+    if (exists(name)) return false;
 
+    //The stock for the ingredient lives in the stock table.
+    int slot = stock->addSlot(quantity, cost);
+    slotNames->push_back(name);
+    addItem(new SimpleIngredient(name, stock, slot, index));
     return true;
 }
 
 /**
  * Adds a new complex ingredient to the pantry.
+ * Fails if an ingredient with that name already exists,
+ * in which case the based on vector is not taken over.
  * @param name The name of the ingredient.
  * @param premium The premium of the ingredient.
  * @param basedOn What the ingredient is based on.
@@ -59,9 +86,9 @@ bool Inventory::addSimpleIngredient(string name, int quantity, float cost){
  */
 bool Inventory::addComplexIngredient(string name,
                                      float premium, vector<Ingredient*>* basedOn){
-    Ingredient* complex = new ComplexIngredient(name, premium, basedOn);
-    pantry->push_back(complex);
+    if (exists(name)) return false;
 
+    addItem(new ComplexIngredient(name, premium, basedOn, index));
     return true;
 }
 
@@ -70,15 +97,11 @@ bool Inventory::addComplexIngredient(string name,
  * @param ing A pointer to the ingredient.
  */
 void Inventory::removeIngredient(Ingredient* ing){
-    delete ing;
+    //Finds the element through the name index.
+    int index = findItem(ing->getName());
+    if (index != -1 && pantry->at(index) == ing) eraseItem(index);
 
-    //Removes the element from the vector.
-    for (int i = 0; i < pantry->size(); i++){
-        if (pantry->at(i) == NULL){
-            pantry->erase(pantry->begin() + i);
-            break;
-        }
-    }
+    delete ing;
 }
 
 /**
@@ -86,19 +109,63 @@ void Inventory::removeIngredient(Ingredient* ing){
  * @param ingName The name of the ingredient.
  * @return Boolean indicating success.
  */
-bool Inventory::removeIngredient(string ingName){
+bool Inventory::removeIngredient(const string& ingName){
     int index = findItem(ingName);
-    pantry->erase(pantry->begin() + index);
+    if (index == -1) return false;
 
+    eraseItem(index);
     return true;
 }
 
+/**
+ * Reserves the stock for a bill of materials. The whole
+ * bill is checked once and then used in one step.
+ * @param bill The compacted bill to reserve.
+ * @return Boolean indicating whether the stock was reserved.
+ */
+bool Inventory::reserve(const BillOfMaterials& bill){
+    return stock->make(bill);
+}
+
+/**
+ * Reserves the stock for a whole order. Adds up the
+ * needs of every sandwich, including substitutions,
+ * so shared ingredients are never counted twice.
+ * @param order The order to reserve.
+ * @return Boolean indicating whether the order was reserved.
+ */
+bool Inventory::reserve(Order* order){
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    order->appendBill(bill);
+    bill.compact();
+
+    return reserve(bill);
+}
+
+/**
+ * Reserves the stock for a whole compact order.
+ * Stale orders are refused.
+ * @param order The order to reserve.
+ * @return Boolean indicating whether the order was reserved.
+ */
+bool Inventory::reserve(CompactOrder* order){
+    if (order->isStale()) return false;
+
+    static thread_local BillOfMaterials bill;
+    bill.clear();
+    order->appendBill(bill);
+    bill.compact();
+
+    return reserve(bill);
+}
+
 /**
  * Checks whether an ingredient exists by name.
  * @param name The name of the ingredient.
  * @return A boolean indicating whether it exists.
  */
-bool Inventory::exists(string name){
+bool Inventory::exists(const string& name){
     int index = findItem(name);
 
     //Check to see if the item exists.
@@ -111,7 +178,7 @@ bool Inventory::exists(string name){
  * @param name The name of the ingredient.
  * @return A pointer to the ingredient in the pantry.
  */
-Ingredient* Inventory::getIngredient(string name){
+Ingredient* Inventory::getIngredient(const string& name){
     Ingredient* current = NULL;
     int index = findItem(name);
     if (index != -1) current = pantry->at(index);
@@ -127,15 +194,17 @@ string Inventory::getInventoryDetails(){
     string items = "INVENTORY DETAILS\n";
     items += "----------------------------------\n";
 
-    if (pantry->size() == 0) {
+    if (getInventorySize() == 0) {
         items += "No items in inventory.";
         return items;
     }
 
     //Iterates to generate text.
-    for (int i = 0; i < pantry->size(); i++)
+    for (int i = 0; i < pantry->size(); i++){
+        if (pantry->at(i) == NULL) continue;
         items += pantry->at(i)->getName()
                  + ": x" + to_string(pantry->at(i)->getQuantity()) + "\n";
+    }
 
     return items;
 }
@@ -145,36 +214,136 @@ string Inventory::getInventoryDetails(){
  * @return The inventory size.
  */
 int Inventory::getInventorySize(){
-    return pantry->size();
+    return pantry->size() - removedItems;
+}
+
+/**
+ * Gets the table holding the stock of every simple ingredient.
+ * Slots of removed ingredients stay in the table unused.
+ * @return The stock table.
+ */
+StockTable* Inventory::getStockTable(){
+    return stock;
+}
+
+/**
+ * Gets the reference index shared by the
+ * ingredients and recipes of this pantry.
+ * @return The reference index.
+ */
+ReferenceIndex* Inventory::getIndex(){
+    return index;
+}
+
+/**
+ * Gets an ingredient by its position in the pantry.
+ * Ingredients are kept in the order they were added.
+ * @param index The position of the ingredient.
+ * @return A pointer to the ingredient.
+ */
+Ingredient* Inventory::getIngredient(int index){
+    compactPantry();
+    return pantry->at(index);
+}
+
+/**
+ * Gets the name of the simple ingredient that was
+ * given a slot in the stock table.
+ * @param slot The slot in the stock table.
+ * @return The name of the ingredient.
+ */
+string Inventory::getSlotName(int slot){
+    return slotNames->at(slot);
 }
 
 /**
  * Gets a random ingredient from the pantry.
- * @return A pointer to the random ingredient.
+ * @param engine The random engine of the caller.
+ * @return A pointer to the random ingredient or NULL if the pantry is empty.
  */
-Ingredient* Inventory::getRandomIngredient(){
-    //Seeds random.
-    srand(time(NULL));
-    return pantry->at(rand() % pantry->size());
+Ingredient* Inventory::getRandomIngredient(mt19937& engine){
+    compactPantry();
+    if (pantry->size() == 0) return NULL;
+
+    uniform_int_distribution<int> distribution(0, pantry->size() - 1);
+    return pantry->at(distribution(engine));
 }
 
 /**
  * Finds an ingredient by name stored in the inventory.
+ * Uses the name index instead of scanning the pantry.
  * @param name The name of the ingredient.
  * @return The position of the ingredient in the vector.
  */
-int Inventory::findItem(std::string name){
-    int index = -1;
-    string current;
+int Inventory::findItem(const string& name){
+    unordered_map<string, int>::const_iterator it = pantryIndex->find(name);
+    if (it == pantryIndex->end()) return -1;
+
+    return it->second;
+}
+
+/**
+ * Adds an ingredient to the end of the pantry
+ * and records its position in the name index.
+ * @param ing The ingredient to add.
+ */
+void Inventory::addItem(Ingredient* ing){
+    (*pantryIndex)[ing->getName()] = pantry->size();
+    pantry->push_back(ing);
+}
+
+/**
+ * Creates the pantry, its name index
+ * and the stock table.
+ */
+void Inventory::createPantry(){
+    pantry = new vector<Ingredient*>();
+    stock = new StockTable();
+    pantryIndex = new unordered_map<string, int>();
+    slotNames = new vector<string>();
+    removedItems = 0;
+}
+
+/**
+ * Erases an ingredient from the pantry. Its position is
+ * left empty so no other item moves; the pantry is
+ * compacted the next time it is read by position.
+ * @param index The position of the ingredient.
+ */
+void Inventory::eraseItem(int index){
+    //Anything compiled from this ingredient is now stale.
+    pantry->at(index)->invalidateReferences();
+    pantryIndex->erase(pantry->at(index)->getName());
 
-    //Iterate through vector to find.
+    //The last item can simply be dropped.
+    if (index == pantry->size() - 1){
+        pantry->pop_back();
+    } else {
+        pantry->at(index) = NULL;
+        removedItems++;
+    }
+}
+
+/**
+ * Closes the gaps left by removed ingredients, keeping
+ * the remaining items in the order they were added.
+ * Runs once for any number of removals.
+ */
+void Inventory::compactPantry(){
+    if (removedItems == 0) return;
+
+    int next = 0;
     for (int i = 0; i < pantry->size(); i++){
-        current = pantry->at(i)->getName();
-        if (current.compare(name) == 0) {
-            index = i;
-            break;
+        if (pantry->at(i) == NULL) continue;
+
+        //Moves the item down and updates its index entry.
+        if (next != i){
+            pantry->at(next) = pantry->at(i);
+            (*pantryIndex)[pantry->at(next)->getName()] = next;
         }
+        next++;
     }
 
-    return index;
+    pantry->resize(next);
+    removedItems = 0;
 }
\ No newline at end of file
@@ -14,13 +14,20 @@
 
 #include <string>
 #include <vector>
+#include <random>
+#include <unordered_map>
 #include "Ingredient.h"
+#include "StockTable.h"
+
+class Order;
+class CompactOrder;
 
 class Inventory {
 
 public:
     /** Constructor/Destructor */
     Inventory();
+    Inventory(ReferenceIndex* index);
     ~Inventory();
 
     /** Add Methods */
@@ -30,23 +37,42 @@ public:
 
     /** Remove Methods */
     void removeIngredient(Ingredient* ing);
-    bool removeIngredient(std::string ingName);
+    bool removeIngredient(const std::string& ingName);
+
+    /** Reserve Methods */
+    bool reserve(const BillOfMaterials& bill);
+    bool reserve(Order* order);
+    bool reserve(CompactOrder* order);
 
     /** Inventory Methods */
-    bool exists(std::string name);
-    Ingredient* getIngredient(std::string name);
+    bool exists(const std::string& name);
+    Ingredient* getIngredient(const std::string& name);
+    Ingredient* getIngredient(int index);
     std::string getInventoryDetails();
     int getInventorySize();
+    StockTable* getStockTable();
+    ReferenceIndex* getIndex();
+    std::string getSlotName(int slot);
 
     /** Simulation Methods */
-    Ingredient* getRandomIngredient();
+    Ingredient* getRandomIngredient(std::mt19937& engine);
 
 private:
     /** Private Variables */
     std::vector<Ingredient*>* pantry;
+    StockTable* stock;
+    std::unordered_map<std::string, int>* pantryIndex;
+    std::vector<std::string>* slotNames;
+    ReferenceIndex* index;
+    bool ownsIndex;
+    int removedItems;
 
     /** Helper Methods */
-    int findItem(std::string name);
+    int findItem(const std::string& name);
+    void addItem(Ingredient* ing);
+    void eraseItem(int index);
+    void compactPantry();
+    void createPantry();
 };
 
 
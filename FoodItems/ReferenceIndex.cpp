@@ -0,0 +1,275 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ReferenceIndex.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Keeps track of which food items reference each other. Every food item
+// gets an id and a list of the items that use it directly, so the graph
+// is updated one edge at a time. Edges are kept unique through a hash
+// set and dead ones are pruned as items are removed. Each bar owns one
+// index.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "ReferenceIndex.h"
+
+using namespace std;
+
+/**
+ * Constructor which creates an empty index.
+ */
+ReferenceIndex::ReferenceIndex(){
+    changes = 0;
+}
+
+/**
+ * Adds a food item to the index. The ids of removed
+ * items are handed out again, lowest first, so a catalog
+ * loaded in one go still gets its ids in creation order.
+ * @param item The food item to add.
+ * @return The id of the food item.
+ */
+int ReferenceIndex::addFood(Food* item){
+    changes++;
+    if (!freeIds.empty()){
+        int id = freeIds.top();
+        freeIds.pop();
+
+        foods[id] = item;
+        return id;
+    }
+
+    foods.push_back(item);
+    generations.push_back(0);
+    referencedBy.push_back(vector<IndexEdge>());
+    uses.push_back(vector<IndexEdge>());
+    deadEdges.push_back(0);
+
+    return foods.size() - 1;
+}
+
+/**
+ * Removes a food item from the index and frees its id.
+ * Edges from the item are left in the lists of what it
+ * used but no longer match its generation, so they are
+ * skipped. A list is pruned once half of it is dead, so
+ * lists don't grow as ids are freed and handed out again.
+ * @param id The id of the food item.
+ */
+void ReferenceIndex::removeFood(int id){
+    if (id < 0 || id >= foods.size() || foods[id] == NULL) return;
+
+    //Counts the edges this item leaves dead.
+    for (int i = 0; i < uses[id].size(); i++){
+        const IndexEdge& used = uses[id][i];
+        if (!isLive(used)) continue;
+
+        edgeKeys.erase(getEdgeKey(used.id, id));
+        deadEdges[used.id]++;
+    }
+
+    //Anything that used this item loses the edge too.
+    for (int i = 0; i < referencedBy[id].size(); i++){
+        edgeKeys.erase(getEdgeKey(id, referencedBy[id][i].id));
+    }
+
+    foods[id] = NULL;
+    generations[id]++;
+
+    //Prunes the lists that are now mostly dead.
+    for (int i = 0; i < uses[id].size(); i++){
+        int used = uses[id][i].id;
+        if (foods[used] != NULL && deadEdges[used] * 2 > referencedBy[used].size()){
+            pruneEdges(referencedBy[used]);
+            deadEdges[used] = 0;
+        }
+    }
+
+    vector<IndexEdge>().swap(referencedBy[id]);
+    vector<IndexEdge>().swap(uses[id]);
+    deadEdges[id] = 0;
+    freeIds.push(id);
+    changes++;
+}
+
+/**
+ * Gets a food item by its id.
+ * @param id The id of the food item.
+ * @return The food item or NULL if it was removed.
+ */
+Food* ReferenceIndex::getFood(int id){
+    if (id < 0 || id >= foods.size()) return NULL;
+
+    return foods[id];
+}
+
+/**
+ * Gets the generation of an id. It goes up every time
+ * the item holding the id is removed, so anything keeping
+ * an id can tell if it was freed or handed out again.
+ * @param id The id of the food item.
+ * @return The generation of the id.
+ */
+unsigned int ReferenceIndex::getGeneration(int id){
+    return generations[id];
+}
+
+/**
+ * Checks whether an id still belongs to the item it
+ * was taken from.
+ * @param id The id of the food item.
+ * @param generation The generation of the id when it was taken.
+ * @return Boolean indicating whether the item is still there.
+ */
+bool ReferenceIndex::isCurrent(int id, unsigned int generation){
+    if (id < 0 || id >= foods.size()) return false;
+
+    return foods[id] != NULL && generations[id] == generation;
+}
+
+/**
+ * Records that something built from the items in the
+ * index, such as a compiled bill, was dropped.
+ */
+void ReferenceIndex::markChanged(){
+    changes++;
+}
+
+/**
+ * Gets a count of the items added, removed or invalidated
+ * so far. Anything built from the whole catalog can compare
+ * it to see whether it has to be rebuilt.
+ * @return The number of changes.
+ */
+unsigned int ReferenceIndex::getChanges(){
+    return changes;
+}
+
+/**
+ * Gets the number of ids handed out.
+ * @return The number of ids, including freed ones.
+ */
+int ReferenceIndex::getSize(){
+    return foods.size();
+}
+
+/**
+ * Records that one food item uses another. An edge that
+ * is already there is not added again, whenever the
+ * reference is made.
+ * @param id The id of the item being used.
+ * @param referrer The id of the item using it.
+ * @return Boolean indicating whether the edge is new.
+ */
+bool ReferenceIndex::addReference(int id, int referrer){
+    if (!edgeKeys.insert(getEdgeKey(id, referrer)).second) return false;
+
+    IndexEdge edge;
+    edge.id = referrer;
+    edge.generation = generations[referrer];
+    referencedBy[id].push_back(edge);
+
+    //Drops dead entries before the list has to grow.
+    vector<IndexEdge>& used = uses[referrer];
+    if (used.size() == used.capacity()) pruneEdges(used);
+
+    edge.id = id;
+    edge.generation = generations[id];
+    used.push_back(edge);
+    return true;
+}
+
+/**
+ * Gets every item that uses a food item, directly or
+ * through other items. They come back in id order.
+ * @param id The id of the food item.
+ * @return The food items referencing this one.
+ */
+vector<Food*> ReferenceIndex::getAllReferences(int id){
+    vector<int> found = getReachable(vector<int>(1, id));
+
+    vector<Food*> references;
+    for (int i = 0; i < found.size(); i++){
+        references.push_back(foods[found[i]]);
+    }
+
+    return references;
+}
+
+/**
+ * Gets the ids of every item that uses any of the given
+ * items, directly or through other items. Walks breadth
+ * first and marks visited ids in a bitset. The bitset is
+ * kept per thread so lookups can run at once, as long as
+ * no item is added or removed meanwhile.
+ * @param ids The ids of the food items.
+ * @return The ids of the references in id order.
+ */
+vector<int> ReferenceIndex::getReachable(const vector<int>& ids){
+    static thread_local vector<unsigned int> visited;
+    if (visited.size() < foods.size() / 32 + 1) visited.resize(foods.size() / 32 + 1, 0);
+
+    vector<int> found;
+    vector<int> pending;
+
+    for (int i = 0; i < ids.size(); i++){
+        if (ids[i] >= 0 && ids[i] < foods.size()) pending.push_back(ids[i]);
+    }
+
+    //The found list doubles as the queue.
+    for (int head = 0; head < pending.size() + found.size(); head++){
+        int current = head < pending.size() ? pending[head] : found[head - pending.size()];
+
+        for (int i = 0; i < referencedBy[current].size(); i++){
+            const IndexEdge& edge = referencedBy[current][i];
+            int next = edge.id;
+            unsigned int bit = 1u << (next % 32);
+            if ((visited[next / 32] & bit) || !isLive(edge)) continue;
+
+            visited[next / 32] |= bit;
+            found.push_back(next);
+        }
+    }
+
+    //Clears only what was marked.
+    for (int i = 0; i < found.size(); i++){
+        visited[found[i] / 32] &= ~(1u << (found[i] % 32));
+    }
+    sort(found.begin(), found.end());
+
+    return found;
+}
+
+/**
+ * Checks whether an edge still points at the item
+ * it was made for.
+ * @param edge The edge to check.
+ * @return Boolean indicating whether the item is still there.
+ */
+bool ReferenceIndex::isLive(const IndexEdge& edge){
+    return foods[edge.id] != NULL && generations[edge.id] == edge.generation;
+}
+
+/**
+ * Removes the dead edges from a list.
+ * @param edges The list to prune.
+ */
+void ReferenceIndex::pruneEdges(vector<IndexEdge>& edges){
+    int next = 0;
+    for (int i = 0; i < edges.size(); i++){
+        if (isLive(edges[i])) edges[next++] = edges[i];
+    }
+
+    edges.resize(next);
+}
+
+/**
+ * Gets the key of an edge in the edge set.
+ * @param id The id of the item being used.
+ * @param referrer The id of the item using it.
+ * @return The key of the edge.
+ */
+unsigned long long ReferenceIndex::getEdgeKey(int id, int referrer){
+    return ((unsigned long long) (unsigned int) id << 32) | (unsigned int) referrer;
+}
@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ReferenceIndex.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Keeps track of which food items reference each other. Every food item
+// gets an id and a list of the items that use it directly, so the graph
+// is updated one edge at a time. Edges are kept unique through a hash
+// set and dead ones are pruned as items are removed. Each bar owns one
+// index.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_REFERENCEINDEX_H
+#define SANDWICH_BAR_REFERENCEINDEX_H
+
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include <vector>
+
+class Food;
+
+struct IndexEdge {
+    int id;
+    unsigned int generation;
+};
+
+class ReferenceIndex {
+public:
+    /** Constructor */
+    ReferenceIndex();
+
+    /** Food Methods */
+    int addFood(Food* item);
+    void removeFood(int id);
+    Food* getFood(int id);
+    int getSize();
+    unsigned int getGeneration(int id);
+    bool isCurrent(int id, unsigned int generation);
+    void markChanged();
+    unsigned int getChanges();
+
+    /** Reference Methods */
+    bool addReference(int id, int referrer);
+    std::vector<Food*> getAllReferences(int id);
+    std::vector<int> getReachable(const std::vector<int>& ids);
+
+private:
+    /** Private Variables */
+    std::vector<Food*> foods;
+    std::vector<unsigned int> generations;
+    std::vector<std::vector<IndexEdge> > referencedBy;
+    std::vector<std::vector<IndexEdge> > uses;
+    std::vector<int> deadEdges;
+    std::unordered_set<unsigned long long> edgeKeys;
+    std::priority_queue<int, std::vector<int>, std::greater<int> > freeIds;
+    unsigned int changes;
+
+    /** Helper Methods */
+    bool isLive(const IndexEdge& edge);
+    void pruneEdges(std::vector<IndexEdge>& edges);
+    static unsigned long long getEdgeKey(int id, int referrer);
+};
+
+
+#endif //SANDWICH_BAR_REFERENCEINDEX_H
@@ -5,7 +5,8 @@
 // Date: 7/22/2016
 //
 // Dictates how a simple ingredient operates. Allows users to use the
-// ingredient. Order more instances of it, and print its details.
+// ingredient. Order more instances of it, and print its details. The
+// quantity and cost live in a slot of the inventory's stock table.
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SimpleIngredient.h"
@@ -13,19 +14,17 @@
 using namespace std;
 
 /**
- * Creates a simple ingredient instance based on several
- * parameters including the name, cost, and number of instances.
+ * Creates a simple ingredient instance that views a
+ * slot in the stock table for its cost and quantity.
  * @param name The name of the ingredient.
- * @param quantity The number of instances.
- * @param cost The cost of the recipe.
+ * @param table The stock table holding the ingredient.
+ * @param slot The slot of the ingredient in the table.
+ * @param index The reference index of the bar.
  */
-SimpleIngredient::SimpleIngredient(string name, int quantity, float cost)
-    : Ingredient(name) {
-    this->quantity = quantity;
-    this->cost = cost;
-
-    //Manages the references.
-    manageReferences();
+SimpleIngredient::SimpleIngredient(string name, StockTable* table, int slot, ReferenceIndex* index)
+    : Ingredient(name, index) {
+    this->table = table;
+    this->slot = slot;
 }
 
 /**
@@ -38,7 +37,7 @@ SimpleIngredient::~SimpleIngredient(){ }
  * @param amount The amount to order.
  */
 void SimpleIngredient::orderMore(int amount){
-    quantity += amount;
+    table->addStock(slot, amount);
 }
 
 /**
@@ -46,7 +45,17 @@ void SimpleIngredient::orderMore(int amount){
  * @return The cost of the ingredient.
  */
 float SimpleIngredient::getCost(){
-    return cost;
+    return table->getCost(slot);
+}
+
+/**
+ * Sets the cost of the ingredient. Anything that
+ * cached a cost based on it is invalidated.
+ * @param cost The new cost of the ingredient.
+ */
+void SimpleIngredient::setCost(float cost){
+    table->setCost(slot, cost);
+    invalidateReferences();
 }
 
 /**
@@ -54,7 +63,7 @@ float SimpleIngredient::getCost(){
  * @return The quantity of the ingredient.
  */
 int SimpleIngredient::getQuantity(){
-    return quantity;
+    return table->getQuantity(slot);
 }
 
 /**
@@ -62,7 +71,7 @@ int SimpleIngredient::getQuantity(){
  * @return Boolean indicating whether we can use it.
  */
 bool SimpleIngredient::canUse() {
-    if (quantity == 0) return false;
+    if (table->getQuantity(slot) <= 0) return false;
     return true;
 }
 
@@ -71,14 +80,32 @@ bool SimpleIngredient::canUse() {
  * @return Boolean indicating whether it was used.
  */
 bool SimpleIngredient::useIngredient() {
-    //Check if we can use that ingredient.
-    if (quantity == 0) {
-        return false;
-    }
+    return table->takeStock(slot, 1);
+}
 
-    //Decrement the quantity otherwise.
-    quantity--;
-    return true;
+/**
+ * Adds this ingredient to a bill of materials.
+ * @param bill The bill to add to.
+ * @param count How many instances are needed.
+ */
+void SimpleIngredient::appendBill(BillOfMaterials& bill, int count) {
+    bill.addItem(this, count);
+}
+
+/**
+ * Gets the stock table holding this ingredient.
+ * @return The stock table.
+ */
+StockTable* SimpleIngredient::getTable() {
+    return table;
+}
+
+/**
+ * Gets the slot of this ingredient in the stock table.
+ * @return The slot number.
+ */
+int SimpleIngredient::getSlot() {
+    return slot;
 }
 
 /**
@@ -91,9 +118,4 @@ string SimpleIngredient::printDetails() {
     text += "\n";
 
     return text;
-}
-
-void SimpleIngredient::updateReferences(std::vector<Food*> references){
-    //We simply pass these references to the update function.
-    addReferences(references);
 }
\ No newline at end of file
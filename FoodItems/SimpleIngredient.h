@@ -5,7 +5,8 @@
 // Date: 7/22/2016
 //
 // Dictates how a simple ingredient operates. Allows users to use the
-// ingredient. Order more instances of it, and print its details.
+// ingredient. Order more instances of it, and print its details. The
+// quantity and cost live in a slot of the inventory's stock table.
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #ifndef SANDWICH_BAR_SIMPLEINGREDIENT_H
@@ -13,31 +14,37 @@
 
 
 #include "Ingredient.h"
+#include "StockTable.h"
 
 class SimpleIngredient : public Ingredient {
 
 public:
     /** Constructor/Destructor */
-    SimpleIngredient(std::string name, int quantity, float cost);
+    SimpleIngredient(std::string name, StockTable* table, int slot, ReferenceIndex* index);
     virtual ~SimpleIngredient();
 
     /** Recipe Operations */
     virtual void orderMore(int amount);
     virtual float getCost();
+    void setCost(float cost);
     virtual int getQuantity();
     virtual bool canUse();
     virtual bool useIngredient();
 
+    /** Bill Methods */
+    virtual void appendBill(BillOfMaterials& bill, int count);
+
+    /** Stock Methods */
+    StockTable* getTable();
+    int getSlot();
+
     /** Print Methods */
     virtual std::string printDetails();
 
-    /** Update Method */
-    void updateReferences(std::vector<Food*> references);
-
 private:
     /** Private Variables */
-    int quantity;
-    float cost;
+    StockTable* table;
+    int slot;
 };
 
 
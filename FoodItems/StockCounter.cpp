@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockCounter.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Lock-free counter holding the quantity of one simple ingredient.
+// Stock can only be taken if there is enough of it, so several
+// threads using the same ingredient can never oversell it.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "StockCounter.h"
+
+using namespace std;
+
+/**
+ * Creates a counter with a starting quantity.
+ * @param quantity The starting quantity.
+ */
+StockCounter::StockCounter(int quantity) : value(quantity) { }
+
+/**
+ * Copies a counter. Only used while the stock table
+ * grows, which never happens during reservations.
+ * @param other The counter to copy.
+ */
+StockCounter::StockCounter(const StockCounter& other) : value(other.get()) { }
+
+/**
+ * Default destructor.
+ */
+StockCounter::~StockCounter(){ }
+
+/**
+ * Assigns the value of another counter.
+ * @param other The counter to copy.
+ * @return This counter.
+ */
+StockCounter& StockCounter::operator=(const StockCounter& other){
+    value.store(other.get());
+    return *this;
+}
+
+/**
+ * Gets the current quantity.
+ * @return The quantity.
+ */
+int StockCounter::get() const {
+    return value.load(memory_order_relaxed);
+}
+
+/**
+ * Adds stock to the counter.
+ * @param amount The amount to add.
+ */
+void StockCounter::add(int amount){
+    value.fetch_add(amount);
+}
+
+/**
+ * Takes stock only if there is enough of it.
+ * Retries if another thread changed the counter first.
+ * @param amount The amount to take.
+ * @return Boolean indicating whether it was taken.
+ */
+bool StockCounter::take(int amount){
+    int current = value.load();
+    while (current >= amount){
+        if (value.compare_exchange_weak(current, current - amount)) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Raises the counter to a level if it is below it.
+ * @param level The level to raise to.
+ */
+void StockCounter::raiseTo(int level){
+    int current = value.load();
+    while (current < level){
+        if (value.compare_exchange_weak(current, level)) return;
+    }
+}
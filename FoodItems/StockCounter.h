@@ -0,0 +1,39 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockCounter.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Lock-free counter holding the quantity of one simple ingredient.
+// Stock can only be taken if there is enough of it, so several
+// threads using the same ingredient can never oversell it.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_STOCKCOUNTER_H
+#define SANDWICH_BAR_STOCKCOUNTER_H
+
+#include <atomic>
+
+class StockCounter {
+public:
+    /** Constructors/Destructor */
+    StockCounter(int quantity);
+    StockCounter(const StockCounter& other);
+    ~StockCounter();
+
+    /** Operators */
+    StockCounter& operator=(const StockCounter& other);
+
+    /** Stock Methods */
+    int get() const;
+    void add(int amount);
+    bool take(int amount);
+    void raiseTo(int level);
+
+private:
+    /** Private Variables */
+    std::atomic<int> value;
+};
+
+
+#endif //SANDWICH_BAR_STOCKCOUNTER_H
@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockTable.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Contiguous table holding the quantity and cost of every simple
+// ingredient. Each simple ingredient owns one slot in the table and
+// reads its stock from there so whole-pantry sweeps stay cache friendly.
+// Quantities are lock-free counters so several threads can reserve
+// orders at once.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <climits>
+#include "StockTable.h"
+
+using namespace std;
+
+/**
+ * Creates an empty stock table.
+ */
+StockTable::StockTable(){ }
+
+/**
+ * Default destructor.
+ */
+StockTable::~StockTable(){ }
+
+/**
+ * Adds a new slot to the table. Slots must not be
+ * added while other threads are using the table.
+ * @param quantity The starting quantity.
+ * @param cost The cost of one instance.
+ * @return The slot number.
+ */
+int StockTable::addSlot(int quantity, float cost){
+    quantities.push_back(StockCounter(quantity));
+    costs.push_back(cost);
+
+    return quantities.size() - 1;
+}
+
+/**
+ * Gets the number of slots in the table.
+ * @return The table size.
+ */
+int StockTable::getSize() const {
+    return quantities.size();
+}
+
+/**
+ * Gets the quantity held in a slot.
+ * @param slot The slot number.
+ * @return The quantity.
+ */
+int StockTable::getQuantity(int slot) const {
+    return quantities[slot].get();
+}
+
+/**
+ * Gets the cost held in a slot.
+ * @param slot The slot number.
+ * @return The cost of one instance.
+ */
+float StockTable::getCost(int slot) const {
+    return costs[slot];
+}
+
+/**
+ * Sets the cost held in a slot.
+ * @param slot The slot number.
+ * @param cost The cost of one instance.
+ */
+void StockTable::setCost(int slot, float cost){
+    costs[slot] = cost;
+}
+
+/**
+ * Adds stock to a slot.
+ * @param slot The slot number.
+ * @param amount The amount to add.
+ */
+void StockTable::addStock(int slot, int amount){
+    quantities[slot].add(amount);
+}
+
+/**
+ * Takes stock from a slot if there is enough.
+ * @param slot The slot number.
+ * @param amount The amount to take.
+ * @return Boolean indicating whether it was taken.
+ */
+bool StockTable::takeStock(int slot, int amount){
+    return quantities[slot].take(amount);
+}
+
+/**
+ * Checks whether every requirement in a bill is in stock.
+ * @param bill The bill to check.
+ * @return Boolean indicating whether the bill can be made.
+ */
+bool StockTable::canMake(const BillOfMaterials& bill) const {
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        if (quantities[items[i].slot].get() < items[i].count) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Uses up the stock for a bill. Each item is taken in
+ * turn and, if one runs short, the items already taken
+ * are put back. Nothing is used unless the whole bill
+ * can be made.
+ * @param bill The bill to make.
+ * @return Boolean indicating success.
+ */
+bool StockTable::make(const BillOfMaterials& bill){
+    return make(bill.getItems());
+}
+
+/**
+ * Uses up the stock for a list of requirements. Works
+ * the same as making a bill.
+ * @param items The requirements, one per slot.
+ * @return Boolean indicating success.
+ */
+bool StockTable::make(const vector<BillItem>& items){
+    for (int i = 0; i < items.size(); i++){
+        if (quantities[items[i].slot].take(items[i].count)) continue;
+
+        //Roll back what was already taken.
+        for (int j = 0; j < i; j++){
+            quantities[items[j].slot].add(items[j].count);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Gets how many times a bill could be made with
+ * the current stock.
+ * @param bill The bill to check.
+ * @return The number of times the bill can be made.
+ */
+int StockTable::getMakeable(const BillOfMaterials& bill) const {
+    int lowest = INT_MAX;
+
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        int current = quantities[items[i].slot].get() / items[i].count;
+        if (current < lowest) lowest = current;
+    }
+
+    return lowest;
+}
+
+/**
+ * Counts the slots holding less than a given level.
+ * @param level The level to compare against.
+ * @return The number of slots below the level.
+ */
+int StockTable::countBelow(int level) const {
+    int count = 0;
+    for (int i = 0; i < quantities.size(); i++){
+        count += (quantities[i].get() < level);
+    }
+
+    return count;
+}
+
+/**
+ * Gets the value of all stock in the table.
+ * @return The total value of the stock.
+ */
+float StockTable::getStockValue() const {
+    float value = 0;
+    for (int i = 0; i < quantities.size(); i++){
+        value += quantities[i].get() * costs[i];
+    }
+
+    return value;
+}
+
+/**
+ * Gets the cost of raising every slot to a given level.
+ * @param level The level to top up to.
+ * @return The cost of the top up.
+ */
+float StockTable::getTopUpCost(int level) const {
+    float cost = 0;
+    for (int i = 0; i < quantities.size(); i++){
+        int missing = level - quantities[i].get();
+        cost += (missing > 0 ? missing : 0) * costs[i];
+    }
+
+    return cost;
+}
+
+/**
+ * Raises every slot below a given level up to that level.
+ * @param level The level to top up to.
+ */
+void StockTable::topUp(int level){
+    for (int i = 0; i < quantities.size(); i++){
+        quantities[i].raiseTo(level);
+    }
+}
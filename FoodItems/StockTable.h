@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockTable.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Contiguous table holding the quantity and cost of every simple
+// ingredient. Each simple ingredient owns one slot in the table and
+// reads its stock from there so whole-pantry sweeps stay cache friendly.
+// Quantities are lock-free counters so several threads can reserve
+// orders at once.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_STOCKTABLE_H
+#define SANDWICH_BAR_STOCKTABLE_H
+
+#include <vector>
+#include "BillOfMaterials.h"
+#include "StockCounter.h"
+
+class StockTable {
+public:
+    /** Constructor/Destructor */
+    StockTable();
+    ~StockTable();
+
+    /** Slot Methods */
+    int addSlot(int quantity, float cost);
+    int getSize() const;
+
+    /** Stock Methods */
+    int getQuantity(int slot) const;
+    float getCost(int slot) const;
+    void setCost(int slot, float cost);
+    void addStock(int slot, int amount);
+    bool takeStock(int slot, int amount);
+
+    /** Bill Methods */
+    bool canMake(const BillOfMaterials& bill) const;
+    bool make(const BillOfMaterials& bill);
+    bool make(const std::vector<BillItem>& items);
+    int getMakeable(const BillOfMaterials& bill) const;
+
+    /** Sweep Methods */
+    int countBelow(int level) const;
+    float getStockValue() const;
+    float getTopUpCost(int level) const;
+    void topUp(int level);
+
+private:
+    /** Private Variables */
+    std::vector<StockCounter> quantities;
+    std::vector<float> costs;
+};
+
+
+#endif //SANDWICH_BAR_STOCKTABLE_H
@@ -9,23 +9,24 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SandwichBar.h"
-#include "Capital/ComplexRecipe.h"
+#include "Simulation/OrderGenerator.h"
+#include "Simulation/Simulator.h"
+#include "Storage/MappedFile.h"
+#include "Storage/Snapshot.h"
+#include "Capital/StockoutImpact.h"
+#include "Capital/PriceUpdate.h"
 #include <iostream>
 #include <iomanip>
-#include <fstream>
-#include <algorithm>
+#include <sstream>
 #include <unistd.h>
 #include <string.h>
 #include <pwd.h>
 #include <functional>
+#include <chrono>
+#include <ctime>
 
 using namespace std;
 
-/** Random Function */
-//std::default_random_engine generator;
-//std::uniform_int_distribution<int> distribution(0, RAND_MAX);
-//auto dice = std::bind(distribution, generator);
-
 /**
  * Static global variable to count
  * the number of recipes and ingredient objects.
@@ -57,13 +58,21 @@ SandwichBar::SandwichBar(string name, float funds) {
  * bar instance.
  */
 SandwichBar::~SandwichBar() {
-    //First, deletes the recipes.
-    for (int i = 0; i < recipeList->size(); i++)
-        delete recipeList->at(i);
-    delete recipeList;
+    //First, closes the journal.
+    delete journal;
+
+    //Next, deletes the recipes.
+    delete loader;
+    delete availability;
+    delete recipes;
 
     //Next, deletes the inventory.
+    delete history;
+    delete planner;
     delete inventory;
+
+    //Finally, deletes the reference index.
+    delete index;
 }
 
 /**
@@ -107,15 +116,25 @@ void SandwichBar::handleCommands() {
 
             }
 
-            simulate(orders);
+            simulate(orders, time(NULL));
+        } else if (line.compare(MONTE) == 0) {
+            monteCarlo();
         } else if (line.compare(ORD) == 0) {
             takeOrder();
         } else if (line.compare(INV) == 0) {
             cout << inventory->getInventoryDetails();
         } else if (line.compare(RECIPES) == 0) {
             cout << getRecipes();
+        } else if (line.compare(AVAIL) == 0) {
+            cout << getAvailable();
         } else if (line.compare(LOOKUP) == 0) {
             lookup();
+        } else if (line.compare(IMPACT) == 0) {
+            impact();
+        } else if (line.compare(RESTOCK) == 0) {
+            restock();
+        } else if (line.compare(FORECAST) == 0) {
+            forecast();
         } else if (line.compare(ADD_R) == 0) {
             addRecipe();
         } else if (line.compare(ADD_I) == 0) {
@@ -126,6 +145,14 @@ void SandwichBar::handleCommands() {
             changeName();
         } else if (line.compare(LOAD) == 0) {
             load();
+        } else if (line.compare(RESTORE) == 0) {
+            restore();
+        } else if (line.compare(SAVE) == 0) {
+            save();
+        } else if (line.compare(PRICES) == 0) {
+            prices();
+        } else if (line.compare(JOURNAL) == 0) {
+            recover();
         } else if (line.compare(EXIT) == 0) {
             iterate = false;
         } else if (line.compare("") == 0) {
@@ -134,6 +161,9 @@ void SandwichBar::handleCommands() {
             //Default case.
             cout << line << ": command not recognized." << endl;
         }
+
+        //Writes out whatever the command logged.
+        if (journal != NULL) journal->flush();
     }
 }
 
@@ -160,8 +190,15 @@ void SandwichBar::setupBar(string name, float funds) {
     }
 
     //Loads in the recipe list and inventory.
-    recipeList = new vector<Recipe*>();
-    inventory = new Inventory();
+    recipes = new RecipeCatalog();
+    availability = new MenuAvailability();
+    index = new ReferenceIndex();
+    inventory = new Inventory(index);
+    planner = new RestockPlanner(inventory->getStockTable(), REORDER_POINT, REORDER_QTY);
+    history = new DemandHistory(inventory->getStockTable(), HISTORY_BUCKETS, BUCKET_ORDERS, SMOOTHING);
+    loader = new CatalogLoader(inventory, recipes);
+    journal = NULL;
+    generation = 0;
 }
 
 /**
@@ -175,15 +212,24 @@ void SandwichBar::printHelp(){
          endl << "orders and recipes." <<
          endl << endl << "Available Commands:" <<
          endl << "simulate : Simulates the entire bar for a set number of orders." <<
+         endl << "monte carlo : Simulates many copies of the bar in parallel." <<
          endl << "order : Prepares an order of a set of sandwiches." <<
          endl << "inventory : Displays the inventory and quantities." <<
          endl << "recipes : Displays the collection of recipes." <<
+         endl << "available : Displays the recipes that can be made right now." <<
          endl << "lookup : Lookup a recipe or ingredient for details." <<
+         endl << "impact : Shows what can't be made if ingredients run out." <<
+         endl << "restock : Buys more of every ingredient below its reorder point or short for an order." <<
+         endl << "forecast : Forecasts how fast an ingredient is being used." <<
          endl << "add recipe : Add a new recipe." <<
          endl << "add ingredient : Add a new ingredient." <<
          endl << "details : Displays sandwich bar name and funds." <<
          endl << "change name : Updates sandwich bar name." <<
          endl << "load : Loads in a collection of recipes and ingredients." <<
+         endl << "load snapshot : Replaces the bar with a saved snapshot." <<
+         endl << "save snapshot : Saves the whole bar to a snapshot." <<
+         endl << "update prices : Applies a file of new ingredient prices." <<
+         endl << "open journal : Replays a journal and logs every change to it." <<
          endl << "quit : Exits the program." << endl;
 }
 
@@ -191,52 +237,126 @@ void SandwichBar::printHelp(){
  * Simulates sandwich bar operation
  * for a desired number of orders.
  * @param numOrders The number of orders to simulate.
+ * @param seed The seed for the random orders.
  */
-void SandwichBar::simulate(int numOrders) {
-    //Seeds the random number generator.
-    srand (time(NULL));
-
+void SandwichBar::simulate(int numOrders, unsigned int seed) {
     //Get the number of recipes.
-    if (recipeList->size() == 0){
+    if (recipes->getSize() == 0){
         cout << "Error: Too few recipes to simulate." << endl;
         return;
     }
 
-    //Start by iterating through the orders.
-    for (int i = 0; i < numOrders; i++){
-        //First, generates an order.
-        Order* currentOrder = generateRandOrder();
+    //Prints every order as it goes.
+    SimulationSettings settings;
+    settings.numOrders = numOrders;
+    settings.seed = seed;
+    settings.popularity = 0;
+    settings.substitutionRate = 0.5;
+    settings.maxSandwiches = SAND_MAX;
+    settings.maxSubstitutions = SUB_MAX;
+    settings.verbose = true;
+
+    SimulationStats stats = runSimulation(settings);
+    if (stats.bankruptAt != -1){
+        cout << name + " has gone bankrupt!\n" << endl;
+    }
+}
 
-        //Now, we print it.
-        cout << currentOrder->printOrder() << endl;
+/**
+ * Runs a simulation with the given settings. Only prints
+ * the orders if the settings ask for it. Funds and stock
+ * are updated as the orders are made.
+ * @param settings The settings of the simulation.
+ * @return The statistics of the simulation.
+ */
+SimulationStats SandwichBar::runSimulation(const SimulationSettings& settings) {
+    if (recipes->getSize() == 0) return SimulationStats();
+
+    //Prepares the order generator.
+    OrderGenerator generator(recipes, inventory, settings.seed);
+    generator.setPopularity(settings.popularity);
+    generator.setSubstitutionRate(settings.substitutionRate);
+    generator.setMaxSandwiches(settings.maxSandwiches);
+    generator.setMaxSubstitutions(settings.maxSubstitutions);
+
+    //Runs the orders against the inventory.
+    Simulator simulator(inventory->getStockTable(), &generator, funds);
+    simulator.setRestockPolicy(*planner);
+    simulator.setHistory(history);
+    simulator.setJournal(journal);
+    if (settings.verbose) simulator.setOutput(&cout);
+
+    SimulationStats stats = simulator.run(settings.numOrders);
+    funds = simulator.getFunds();
+
+    return stats;
+}
 
-        //Perform order logic.
-        if (currentOrder->makeOrder()){
-            cout << "Order was successful.\n";
+/**
+ * Runs many independent copies of the bar with the
+ * same settings spread over every core. The bar itself
+ * is left untouched.
+ * @param settings The settings every copy uses.
+ * @param numReplicas The number of copies to run.
+ * @param numThreads The number of threads or 0 for every core.
+ * @return The distribution of the results.
+ */
+MonteCarloStats SandwichBar::runMonteCarlo(const SimulationSettings& settings, int numReplicas, int numThreads) {
+    MonteCarlo driver(inventory, recipes, funds);
+    driver.setRestockPolicy(planner);
 
-            if (i + 1 < numOrders)
-                cout << endl;
-        } else {
-            cout << "Not enough ingredients are available. Ordering more...\n" << endl;
+    return driver.run(settings, numReplicas, numThreads);
+}
 
-            //Order more. And then order again.
-            if (!orderMore(currentOrder)){
-                cout << name + " has gone bankrupt!\n" << endl;
-                return;
-            } else {
-                cout << "Order was successful.\n";
+/**
+ * Prompts for the number of orders and replicas
+ * and prints the distribution of the results.
+ */
+void SandwichBar::monteCarlo() {
+    int orders = -1;
+    int replicas = -1;
+    string line;
 
-                if (i + 1 < numOrders)
-                    cout << endl;
-            }
+    //Get the number of recipes.
+    if (recipes->getSize() == 0){
+        cout << "Error: Too few recipes to simulate." << endl;
+        return;
+    }
 
-            currentOrder->makeOrder();
+    //Prompt the user for number of orders.
+    while (orders < 1 || orders > ORD_MAX) {
+        cout << "Enter the number of orders per replica: ";
+        getline(cin, line);
+
+        try {
+            orders = stoi(line);
+        } catch (...) {
+            cout << "Invalid simulation value." << endl;
         }
+    }
+
+    //Prompt the user for number of replicas.
+    while (replicas < 1 || replicas > REP_MAX) {
+        cout << "Enter the number of replicas: ";
+        getline(cin, line);
 
-        //Receive payment.
-        funds += currentOrder->getTotalCost();
-        delete currentOrder;
+        try {
+            replicas = stoi(line);
+        } catch (...) {
+            cout << "Invalid replica value." << endl;
+        }
     }
+
+    SimulationSettings settings;
+    settings.numOrders = orders;
+    settings.seed = time(NULL);
+    settings.popularity = 0;
+    settings.substitutionRate = 0.5;
+    settings.maxSandwiches = SAND_MAX;
+    settings.maxSubstitutions = SUB_MAX;
+    settings.verbose = false;
+
+    cout << runMonteCarlo(settings, replicas, 0).print();
 }
 
 /**
@@ -265,7 +385,7 @@ void SandwichBar::takeOrder() {
         getline(cin, sandwich);
 
         //Looks up the recipe.
-        Recipe* currentRecipe = findRecipe(sandwich);
+        Recipe* currentRecipe = recipes->getRecipe(sandwich);
 
         //Checks if we found it.
         if (currentRecipe == NULL){
@@ -344,9 +464,16 @@ void SandwichBar::takeOrder() {
          << setprecision(2)
          << setfill( '0' ) << current->getTotalCost()
          << endl;
-    if (!current->makeOrder()){
+    BillOfMaterials bill;
+    current->appendBill(bill);
+    bill.compact();
+    if (!inventory->reserve(bill)){
+        //The next restock covers what the order was short.
+        planner->addDemand(bill);
         cout << "Sorry, we are out of ingredients." << endl;
     } else {
+        history->record(bill);
+        if (journal != NULL) journal->logOrder(bill, current->getTotalCost());
         funds += current->getTotalCost();
         cout << "Have a great day, " << person << "!" << endl;
     }
@@ -365,18 +492,56 @@ string SandwichBar::getRecipes() {
     recipeText += "----------------------------------\n";
 
     //Check if we have any recipes.
-    if (recipeList->size() == 0){
+    if (recipes->getSize() == 0){
         recipeText += "No recipes are present.\n";
         return recipeText;
     }
 
-    for (int i = 0; i < recipeList->size(); i++){
-        recipeText += recipeList->at(i)->print();
+    for (int i = 0; i < recipes->getSize(); i++){
+        recipeText += recipes->getRecipe(i)->print();
+    }
+
+    return recipeText;
+}
+
+/**
+ * Prepares a string listing the recipes
+ * that can be made with the current inventory.
+ * @return String with the makeable recipes.
+ */
+string SandwichBar::getAvailable() {
+    string recipeText = "AVAILABLE RECIPES\n";
+    recipeText += "----------------------------------\n";
+
+    vector<unsigned int> bitmap;
+    getMakeableRecipes(bitmap);
+
+    int found = 0;
+    for (int i = 0; i < recipes->getSize(); i++){
+        if (MenuAvailability::isSet(bitmap, i)){
+            recipeText += recipes->getRecipe(i)->getName() + "\n";
+            found++;
+        }
     }
 
+    if (found == 0) recipeText += "No recipes can be made.\n";
     return recipeText;
 }
 
+/**
+ * Checks the whole menu against the inventory at once.
+ * Bit i of the bitmap is set if recipe id i can be made.
+ * @param bitmap The bitmap to fill in.
+ */
+void SandwichBar::getMakeableRecipes(vector<unsigned int>& bitmap){
+    //Rebuild the matrix if the catalog changed since.
+    if (availability->isStale(index)){
+        availability->build(recipes, index);
+    }
+
+    availability->check(*inventory->getStockTable(), bitmap);
+}
+
 /**
  * Looks up a recipe or ingredient
  * based on a user's input. Searches
@@ -398,7 +563,7 @@ void SandwichBar::lookup(){
     }
 
     //Otherwise, find a recipe.
-    Recipe* rec = findRecipe(line);
+    Recipe* rec = recipes->getRecipe(line);
     if (rec != NULL){
         cout << rec->printDetails();
         return;
@@ -408,6 +573,142 @@ void SandwichBar::lookup(){
     cout << "That item does not exist!" << endl;
 }
 
+/**
+ * Shows every complex ingredient and recipe that can't
+ * be made if a list of ingredients runs out.
+ */
+void SandwichBar::impact(){
+    string line;
+    vector<Ingredient*> missing;
+
+    //Get the ingredients that ran out.
+    cout << "Enter the ingredients that ran out (comma separated): ";
+    getline(cin, line);
+
+    //Looks up each of the names.
+    stringstream names(line);
+    string name;
+    while (getline(names, name, ',')){
+        name.erase(0, name.find_first_not_of(' '));
+        name.erase(name.find_last_not_of(' ') + 1);
+        if (name.compare("") == 0) continue;
+
+        Ingredient* ing = inventory->getIngredient(name);
+        if (ing == NULL){
+            cout << name << ": ingredient does not exist!" << endl;
+            return;
+        }
+        missing.push_back(ing);
+    }
+    if (missing.size() == 0) return;
+
+    //Computes the impact.
+    StockoutImpact result;
+    result.compute(missing);
+
+    cout << "The following can no longer be made:" << endl << result.print();
+}
+
+/**
+ * Restocks the bar in one purchase. Lets the user change
+ * the reorder levels of an ingredient, then plans every
+ * ingredient below its reorder point and asks before
+ * paying for it. Orders that ran out since the last
+ * restock are added up and covered by the purchase.
+ */
+void SandwichBar::restock(){
+    string line;
+
+    //Lets the user change the levels first.
+    cout << "Change the reorder levels of an ingredient? (Y/N)" << endl << "\t";
+    getline(cin, line);
+    if (line.compare("y") == 0 || line.compare("Y") == 0){
+        cout << "Enter the ingredient name: ";
+        getline(cin, line);
+
+        SimpleIngredient* ing = dynamic_cast<SimpleIngredient*>(inventory->getIngredient(line));
+        if (ing == NULL){
+            cout << line << ": simple ingredient does not exist!" << endl;
+            return;
+        }
+
+        int point = -1;
+        while (point < 0) {
+            cout << "Enter the reorder point: ";
+            getline(cin, line);
+
+            try {
+                point = stoi(line);
+            } catch (...) {
+                cout << "Invalid reorder value." << endl;
+            }
+        }
+
+        int quantity = -1;
+        while (quantity < 0) {
+            cout << "Enter the reorder quantity: ";
+            getline(cin, line);
+
+            try {
+                quantity = stoi(line);
+            } catch (...) {
+                cout << "Invalid reorder value." << endl;
+            }
+        }
+
+        if (!planner->setPolicy(ing->getSlot(), point, quantity)){
+            cout << "Could not change the reorder levels of " << ing->getName() << "." << endl;
+            return;
+        }
+    }
+
+    //Plans every ingredient at once.
+    planner->planAll();
+    cout << planner->print(inventory);
+    if (planner->getPurchases().size() == 0) return;
+
+    cout << "Place the order? (Y/N)" << endl << "\t";
+    getline(cin, line);
+    if (line.compare("y") != 0 && line.compare("Y") != 0) return;
+
+    if (!planner->purchase(funds)){
+        cout << "Sorry, " << name << " can't afford this order." << endl;
+    } else {
+        if (journal != NULL) journal->logRestock(planner->getPurchases(), planner->getCost());
+        planner->clearDemand();
+        cout << "The order has been placed." << endl;
+    }
+}
+
+/**
+ * Forecasts the use of a simple ingredient from the
+ * orders made so far. A period is a fixed number of
+ * orders.
+ */
+void SandwichBar::forecast(){
+    string line;
+    cout << "Enter the ingredient to forecast: ";
+    getline(cin, line);
+
+    SimpleIngredient* ing = dynamic_cast<SimpleIngredient*>(inventory->getIngredient(line));
+    if (ing == NULL){
+        cout << line << ": simple ingredient does not exist!" << endl;
+        return;
+    }
+
+    float average = history->getMovingAverage(ing->getSlot());
+    float smoothed = history->getSmoothed(ing->getSlot());
+    cout << "Orders recorded: " << history->getOrders()
+         << " (" << history->getOrdersPerBucket() << " per period)" << endl
+         << fixed << setprecision(2)
+         << "Moving average: " << average << " per period" << endl
+         << "Smoothed: " << smoothed << " per period" << endl;
+
+    if (smoothed > 0){
+        cout << "Current stock lasts about " << ing->getQuantity() / smoothed << " periods." << endl;
+    }
+}
+
 /**
  * Adds a new recipe to the recipe list
  * based on the user's input. Uses helper
@@ -435,10 +736,12 @@ void SandwichBar::addRecipe(){
 
         //Perform the addition.
         string msg;
-        bool success = addRecipeLine(line, &msg);
+        bool success = loader->addRecipeLine(StringRef(line), &msg);
         if (!success){
             //Print error message.
             cout << "\t" << msg << endl;
+        } else if (journal != NULL){
+            journal->logText(Journal::RECIPE_RECORD, line);
         }
     }
 }
@@ -469,10 +772,12 @@ void SandwichBar::addIngredient(){
 
         //Perform the addition.
         string msg;
-        bool success = addIngredientLine(line, &msg);
+        bool success = loader->addIngredientLine(StringRef(line), &msg);
         if (!success){
             //Print error message.
             cout << "\t" << msg << endl;
+        } else if (journal != NULL){
+            journal->logText(Journal::INGREDIENT_RECORD, line);
         }
     }
 }
@@ -517,602 +822,453 @@ void SandwichBar::changeName(){
  * of the sandwich bar.
  */
 void SandwichBar::load() {
-    string line;
-    int lineNum = 0;
-    bool barFlag = false;
-    bool ingFlag = false;
-    bool recipeFlag = false;
-    bool alreadyBar = false;
-    bool error = false;
-
     //Asks the user for a file name.
     string filename;
     cout << "Enter filename to load: ";
     getline(cin, filename);
 
-    //Loads the file.
-    ifstream loadStream;
-    loadStream.open(filename);
-    if (loadStream.is_open()) {
-        while (getline (loadStream,line)){
-            lineNum++;
-
-            //Checks for blank characters.
-            if ((line.compare(0, 2, "//") == 0) || line.empty())
-                continue;
-
-            //Checks what line we are dealing with.
-            if (line.compare(BAR_FLAG) == 0){
-                //Perform sanity check.
-                if (barFlag == true) {
-                    cout << "Error on line " << lineNum
-                         << ": BAR command already encountered." <<endl;
-                    error = true;
-                    break;
-                }
-
-                barFlag = true;
-            } else if (line.compare(ING_FLAG) == 0){
-                //Perform sanity check.
-                if (barFlag != true){
-                   cout << "Error on line " << lineNum
-                        << ": BAR command comes first." << endl;
-                    error = true;
-                    break;
-                } else if (ingFlag == true){
-                    cout << "Error on line " << lineNum
-                         << ": INGREDIENT command already encountered." <<endl;
-                    error = true;
-                    break;
-                }
+    loadFile(filename);
+}
 
-                ingFlag = true;
-            } else if (line.compare(RECIPE_FLAG) == 0) {
-                //Perform sanity check.
-                if (barFlag != true){
-                    cout << "Error on line " << lineNum
-                         << ": BAR command comes first." << endl;
-                    error = true;
-                    break;
-                } else if (ingFlag != true){
-                    cout << "Error on line " << lineNum
-                         << ": INGREDIENT command comes first." <<endl;
-                    error = true;
-                    break;
-                } else if (recipeFlag == true){
-                    cout << "Error on line " << lineNum
-                         << ": RECIPE command already encountered." <<endl;
-                    error = true;
-                    break;
-                }
+/**
+ * Loads in a file and creates the specified
+ * ingredients, recipes, and name of the
+ * sandwich bar.
+ * @param filename The file to load.
+ * @return Boolean indicating success.
+ */
+bool SandwichBar::loadFile(string filename) {
+    return loadCatalog(filename, false, 1);
+}
 
-                recipeFlag = true;
-            } else if (recipeFlag == true) {
-                //Parse the line.
-                string msg;
-                bool succ = addRecipeLine(line, &msg);
-
-                //Check for errors.
-                if (!succ){
-                    cout << "Error on line " << lineNum
-                         << ": " << msg << endl;
-                    error = true;
-                    break;
-                }
-            } else if (ingFlag == true) {
-                //Parse the line.
-                string msg;
-                bool succ = addIngredientLine(line, &msg);
-
-                //Check for errors.
-                if (!succ){
-                    cout << "Error on line " << lineNum
-                         << ": " << msg << endl;
-                    error = true;
-                    break;
-                }
-            } else if (barFlag == true) {
-                //Parse the bar information.
-                vector<string>* tokens = tokenize(line);
-
-                //Check for sanity.
-                if (alreadyBar == true){
-                    cout << "Error on line " << lineNum
-                        << ": BAR information already set." << endl;
-                    error = true;
-
-                    delete tokens;
-                    break;
-                } else if (tokens->size() != 2) {
-                    cout << "Error on line " << lineNum
-                        << ": Invalid BAR command." <<endl;
-
-                    delete tokens;
-                    break;
-                }
+/**
+ * Loads in a file using several threads. Names
+ * may be used before the line that defines them
+ * and nothing is added if any line is bad.
+ * @param filename The file to load.
+ * @param numThreads The number of threads or 0 for every core.
+ * @return Boolean indicating success.
+ */
+bool SandwichBar::loadFileParallel(string filename, int numThreads) {
+    return loadCatalog(filename, true, numThreads);
+}
 
-                //Read in the bar name.
-                name = tokens->at(0);
-                funds = stof(tokens->at(1));
+/**
+ * Driver method that replaces the
+ * bar with a saved snapshot.
+ */
+void SandwichBar::restore() {
+    //Asks the user for a file name.
+    string filename;
+    cout << "Enter snapshot to load: ";
+    getline(cin, filename);
 
-                //Delete the tokens.
-                alreadyBar = true;
-                delete tokens;
-            } else {
-                cout << "Unknown error encountered at line " << lineNum << "." << endl;
-                error = true;
-                break;
-            }
-        }
+    loadSnapshot(filename);
+}
 
-        //Deals with the end.
-        loadStream.close();
+/**
+ * Driver method that saves the
+ * bar to a snapshot.
+ */
+void SandwichBar::save() {
+    //Asks the user for a file name.
+    string filename;
+    cout << "Enter snapshot to save: ";
+    getline(cin, filename);
 
-        //Prints the results.
-        if (error) {
-            cout << "Load aborted!" << endl;
-        } else {
-            cout << name << " is now in business!" << endl;
-        }
-    } else {
-        cout << "File could not be opened!" << endl;
-    }
+    saveSnapshot(filename);
 }
 
 /**
- * Prints the header that is shown when the
- * program is started.
+ * Prompts for a price file and applies it to the bar.
  */
-void SandwichBar::printHeader(){
-    string header = "------------------------------------------------------\n";
-    header += "| Sandwich Bar v0.1                                  |\n";
-    header += "| C++ Version                                        |\n";
-    header += "|                                                    |\n";
-    header += "| University of Waterloo, 2016                       |\n";
-    header += "------------------------------------------------------\n";
+void SandwichBar::prices() {
+    //Asks the user for a file name.
+    string filename;
+    cout << "Enter price file to apply: ";
+    getline(cin, filename);
 
-    //Prints the header.
-    cout << header;
+    updatePrices(filename);
 }
 
 /**
- * Helper method which takes a string and tokenizes it
- * based on a comma.
- * @param line The line to tokenize.
- * @return A vector with all the string tokens.
+ * Driver method that prompts for a journal
+ * and how often it is synced.
  */
-vector<string>* SandwichBar::tokenize(string line) {
-    vector<string>* tokens = new vector<string>();
-
-    //Copies the line into a c string.
-    char* cLine = new char[line.length() + 1];
-    strcpy(cLine, line.c_str());
+void SandwichBar::recover() {
+    //Asks the user for a file name.
+    string filename;
+    cout << "Enter journal to open: ";
+    getline(cin, filename);
 
-    //Iterates through the tokens.
-    char* current = strtok(cLine, ",");
-    while(current != NULL){
-        string item(current);
-        tokens->push_back(item);
+    int records = -1;
+    string line;
+    while (records < 0) {
+        cout << "Enter the records per sync (0 to never sync): ";
+        getline(cin, line);
 
-        current = strtok(NULL, ",");
+        try {
+            records = stoi(line);
+        } catch (...) {
+            cout << "Invalid sync value." << endl;
+        }
     }
 
-    delete[] cLine;
-    delete[] current;
-
-    return tokens;
+    openJournal(filename, records);
 }
 
 /**
- * Generates a randomized order for one customer.
- * Prepares a random number of sandwiches and
- * a random number of substitutions.
- * @return A pointer to the generated order.
+ * Replaces the bar with a saved snapshot. The snapshot
+ * is loaded into a new inventory and catalog first so a
+ * bad snapshot leaves the bar as it was.
+ * @param filename The snapshot to load.
+ * @return Boolean indicating success.
  */
-Order* SandwichBar::generateRandOrder() {
-    int nameIndex = /*dice()*/10 % names->length();
+bool SandwichBar::loadSnapshot(string filename) {
+    MappedFile file;
+    if (!file.open(filename)){
+        cout << "File could not be opened!" << endl;
+        return false;
+    }
 
-    //First, generate random name.
-    string orderee = names[nameIndex];
-    Order* randomOrder = new Order(orderee);
+    Inventory* newInventory = new Inventory(index);
+    RecipeCatalog* newRecipes = new RecipeCatalog();
+    Snapshot snapshot(newInventory, newRecipes);
 
-    //Now decides the number of sandwiches.
-    int numSand = /*dice()*/10 % SAND_MAX + 1;
+    string msg;
+    if (!snapshot.load(file.getData(), file.getSize(), &msg)){
+        cout << msg << endl;
+        cout << "Load aborted!" << endl;
 
-    //Generates a random sandwich.
-    for (int i = 0; i < numSand; i++){
-        randomOrder->addSandwich(generateRandSandwich());
+        delete newRecipes;
+        delete newInventory;
+        return false;
     }
 
-    return randomOrder;
+    //Swaps in the loaded bar.
+    delete loader;
+    delete recipes;
+    delete history;
+    delete planner;
+    delete inventory;
+    recipes = newRecipes;
+    inventory = newInventory;
+    planner = new RestockPlanner(inventory->getStockTable(), REORDER_POINT, REORDER_QTY);
+    history = new DemandHistory(inventory->getStockTable(), HISTORY_BUCKETS, BUCKET_ORDERS, SMOOTHING);
+    loader = new CatalogLoader(inventory, recipes);
+    availability->invalidate();
+
+    name = snapshot.getName();
+    funds = snapshot.getFunds();
+    generation = snapshot.getGeneration();
+
+    //Anything journaled before was replaced along with the bar.
+    if (journal != NULL && (!journal->beginRotation(generation) || !journal->finishRotation())){
+        closeJournal("Journal could not be rotated.");
+    }
+    cout << name << " is now in business!" << endl;
+    return true;
 }
 
 /**
- * Helper method which generates a random sandwich
- * for the random order.
- * @return A pointer to the generated random sandwich.
+ * Saves the whole bar to a snapshot under a new generation.
+ * An empty journal for that generation is synced before the
+ * snapshot is renamed into place, so a crash at any point
+ * leaves a snapshot and journal that open together.
+ * @param filename The snapshot to write.
+ * @return Boolean indicating success.
  */
-Sandwich* SandwichBar::generateRandSandwich(){
-    //First, we select a random recipe.
-    int recipeIndex = /*dice()*/10 % recipeList->size();
-    Recipe* decidedRecipe = recipeList->at(recipeIndex);
-
-    //Now we decide if we need a substitution.
-    int oddEven = /*dice()*/10 % 4;
-    if (oddEven % 2){
-        return new Sandwich(decidedRecipe);
-    }
+bool SandwichBar::saveSnapshot(string filename) {
+    Snapshot snapshot(inventory, recipes);
+    uint64_t next = nextGeneration();
 
-    //Generate a substitution.
-    Substitution* substitution = new Substitution();
-    vector<Ingredient*> ingredients = decidedRecipe->getIngredients();
-    uniform_int_distribution<int> ingGen(0, ingredients.size());
-
-    //Goes through and substitutes.
-    int numSubs = /*dice()*/10 % SUB_MAX + 1;
-    for (int i = 0; i < numSubs; i++){
-        oddEven = /*dice()*/10 % 4;
-
-        //Add a substitution.
-        if (oddEven % 2){
-            //We loop until the ingredient is there.
-            bool bad = true;
-            while(bad){
-                Ingredient* ing = inventory->getRandomIngredient();
-                vector<Ingredient*> adds = substitution->getAdditions();
-
-                //Sees if the ingredient exists.
-                if (find(ingredients.begin(), ingredients.end(), ing)
-                    == ingredients.end() && find(adds.begin(), adds.end(), ing) ==
-                                            adds.end()){
-                    bad = false;
-                    substitution->addAddition(ing);
-                }
-            }
-        } else {
-            //Pick a random ingredient to remove.
-            bool bad = true;
-            while (bad){
-                Ingredient* removed = ingredients.at(/*dice()*/10 % ingredients.size());
-
-                vector<Ingredient*> removes = substitution->getRemovals();
-                if (find(removes.begin(), removes.end(), removed) ==
-                    removes.end()){
-                    bad = false;
-                    substitution->addRemoval(removed);
-                }
-            }
-        }
+    if (journal != NULL && !journal->beginRotation(next)){
+        cout << "Journal could not be written." << endl;
+        return false;
     }
 
-    return new Sandwich(decidedRecipe, substitution);
+    string msg;
+    if (!snapshot.save(filename, name, funds, next, &msg)){
+        if (journal != NULL) journal->cancelRotation();
+        cout << msg << endl;
+        return false;
+    }
+    generation = next;
 
+    //The snapshot now holds everything the journal did.
+    if (journal != NULL && !journal->finishRotation()) closeJournal("Journal could not be rotated.");
+    cout << "Snapshot saved to " << filename << "." << endl;
+    return true;
 }
 
 /**
- * Helper method that orders more ingredients for all the items
- * in the order. Allows ingredients to never run out when simulating
- * the sandwich bar.
- * @param currentOrder The order being simulated.
- * @return A boolean indicating success.
+ * Applies a file of new simple ingredient prices. Costs
+ * built on the changed ingredients are recomputed once
+ * for the whole file. Nothing changes if any line is bad.
+ * @param filename The price file to apply.
+ * @return Boolean indicating success.
  */
-bool SandwichBar::orderMore(Order* currentOrder){
-    //Get the ingredients.
-    vector<Sandwich*> sandwiches = currentOrder->getSandwiches();
-    for (int i = 0; i < sandwiches.size(); i++){
-        vector<Ingredient*> ingredients = sandwiches.at(i)->getRecipe().getIngredients();
-
-        //We now iterate through the ingredients for that recipe.
-        for (int j = 0; j < ingredients.size(); j++){
-            if (funds < ING_FACTOR * ingredients.at(j)->getCost()){
-                return false;
-            }
-
-            //Update the funds and order more.
-            funds -= ING_FACTOR * ingredients.at(j)->getCost();
-            ingredients.at(j)->orderMore(ING_FACTOR);
-        }
-
-        //Next, we iterate through the sandwich additions.
-        if (sandwiches.at(i)->hasSubstitution()) {
-            ingredients = sandwiches.at(i)->getSubstitution().getAdditions();
-            for (int j = 0; j < ingredients.size(); j++){
-                if (funds < ING_FACTOR * ingredients.at(j)->getCost()){
-                    return false;
-                }
+bool SandwichBar::updatePrices(string filename) {
+    MappedFile file;
+    if (!file.open(filename)){
+        cout << "File could not be opened!" << endl;
+        return false;
+    }
 
-                //Update the funds and order more.
-                funds -= ING_FACTOR * ingredients.at(j)->getCost();
-                ingredients.at(j)->orderMore(ING_FACTOR);
-            }
-        }
+    PriceUpdate update;
+    string msg;
+    if (!loader->loadPrices(file.getData(), file.getSize(), update, &msg)){
+        cout << msg << endl;
+        cout << "Price update aborted!" << endl;
+        return false;
     }
 
+    int count = update.getSize();
+    update.apply();
+    if (journal != NULL) journal->logText(Journal::PRICE_RECORD, string(file.getData(), file.getSize()));
+
+    cout << "Updated " << count << " ingredient prices." << endl;
+    cout << update.print();
     return true;
 }
 
 /**
- * Adds an ingredient to the inventory
- * based on some line of text.
- * @param line The line to add.
- * @param msg A string that will have an error message returned.
- * @return A boolean indicating success.
+ * Maps a catalog file and loads it into the bar.
+ * @param filename The file to load.
+ * @param parallel Whether to use the parallel loader.
+ * @param numThreads The number of threads for the parallel loader.
+ * @return Boolean indicating success.
  */
-bool SandwichBar::addIngredientLine(string line, string* msg){
-//Parse the ingredients.
-    vector<string>* tokens = tokenize(line);
-
-    //Check type of ingredient.
-    if (tokens->at(0).compare(SIMPLE) == 0){
-        //Perform sanity check.
-        if (tokens->size() != 4) {
-            *msg = "Invalid INGREDIENT command.";
-
-            delete tokens;
-            return false;
-        }
-
-        //Adds in the ingredient.
-        inventory->addSimpleIngredient(tokens->at(1),
-                                       stoi(tokens->at(3)), stof(tokens->at(2)));
-    } else if (tokens->at(0).compare(COMPLEX) == 0) {
-        //Perform sanity check.
-        if (tokens->size() < 4) {
-            *msg = "Invalid INGREDIENT command.";
-
-            delete tokens;
-            return false;
-        } else if (tokens->at(3).compare("{}") == 0
-                   || tokens->at(3).compare("{ }") == 0){
-            *msg = "Invalid INGREDIENT command.";
+bool SandwichBar::loadCatalog(string filename, bool parallel, int numThreads) {
+    //Maps the file so it can be parsed in place.
+    MappedFile file;
+    if (!file.open(filename)){
+        cout << "File could not be opened!" << endl;
+        return false;
+    }
 
-            delete tokens;
-            return false;
-        }
+    //A failed load can still change the bar so it is always logged.
+    string msg;
+    bool success = applyCatalog(file.getData(), file.getSize(), parallel, numThreads, &msg);
+    if (journal != NULL) journal->logCatalog(file.getData(), file.getSize(), parallel);
 
-        //Next, parses the subcommands.
-        vector<Ingredient*>* listOfIngredients = new vector<Ingredient*>();
-        for (int i = 3; i < tokens->size(); i++){
-            string currentItem = tokens->at(i);
+    //Prints the results.
+    if (!success) {
+        cout << msg << endl;
+        cout << "Load aborted!" << endl;
+        return false;
+    }
 
-            //Removes the curly braces.
-            if (i == 3){
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '{'), currentItem.end());
-            }
-            if (i == tokens->size() - 1){
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '}'), currentItem.end());
-            }
+    cout << name << " is now in business!" << endl;
+    return true;
+}
 
-            //Get the ingredient.
-            Ingredient* current = inventory->getIngredient(currentItem);
-            if (current == NULL){
-                *msg = "Complex ingredient references non-existent ingredient.";
+/**
+ * Loads catalog text into the bar and reads in
+ * the bar information.
+ * @param data The catalog text.
+ * @param size The size of the text.
+ * @param parallel Whether to use the parallel loader.
+ * @param numThreads The number of threads for the parallel loader.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool SandwichBar::applyCatalog(const char* data, size_t size, bool parallel, int numThreads, string* msg) {
+    bool success;
+    if (parallel) success = loader->loadParallel(data, size, numThreads, msg);
+    else success = loader->load(data, size, msg);
+
+    //Reads in the bar information.
+    if (loader->hasBar()){
+        name = loader->getName();
+        funds = loader->getFunds();
+    }
 
-                delete tokens;
-                return false;
-            }
-            listOfIngredients->push_back(current);
-        }
+    return success;
+}
 
-        //Now, we create the ingredient.
-        inventory->addComplexIngredient(tokens->at(1),
-                                        stof(tokens->at(2)), listOfIngredients);
-    } else {
-        *msg = "Unknown ingredient command.";
+/**
+ * Opens a journal and replays everything in it on top
+ * of the bar. The journal must have been started for the
+ * snapshot the bar holds, so it should be opened right
+ * after loading that snapshot. Every change to the bar
+ * afterwards is logged to it.
+ * @param filename The journal to open.
+ * @param syncInterval The records per fsync or 0 to never sync.
+ * @return Boolean indicating success.
+ */
+bool SandwichBar::openJournal(string filename, int syncInterval) {
+    delete journal;
+    journal = new Journal();
 
-        delete tokens;
+    string msg;
+    if (!journal->open(filename, generation, &msg) || !replayJournal(&msg)){
+        closeJournal(msg);
         return false;
     }
 
-    delete tokens;
-    *msg = "";
+    journal->setSyncInterval(syncInterval);
+    cout << "Replayed " << journal->getRecovered() << " journal records." << endl;
+    if (journal->wasTruncated()) cout << "A torn record was dropped from the end of the journal." << endl;
     return true;
 }
 
 /**
- * Adds a recipe to the recipe list
- * based on some line of text.
- * @param line The line to add.
+ * Replays the records left in the journal onto a copy of
+ * the bar. The copy only replaces the bar once every record
+ * fits, so a journal that doesn't match leaves the bar as
+ * it was. Slots keep their numbers in the copy since the
+ * bar never removes ingredients.
  * @param msg A string that will have an error message returned.
- * @return A boolean indicating success.
+ * @return Boolean indicating success.
  */
-bool SandwichBar::addRecipeLine(string line, string* msg){
-    //Parse the current line for recipes.
-    vector<string>* tokens = tokenize(line);
-
-    //Check what type of recipe we have.
-    if (tokens->at(0).compare(SIMPLE) == 0){
-        //Perform sanity check.
-        if (tokens->size() < 4){
-            *msg = "Invalid RECIPE command.";
-
-            delete tokens;
-            return false;
-        } else if (tokens->at(3).compare("{}") == 0
-                   || tokens->at(3).compare("{ }") == 0){
-            *msg = "Invalid RECIPE command.";
-
-            delete tokens;
-            return false;
-        }
+bool SandwichBar::replayJournal(string* msg) {
+    if (journal->getRecovered() == 0) return true;
+
+    //Copies the bar through an in-memory snapshot.
+    string copy;
+    Snapshot current(inventory, recipes);
+    if (!current.write(copy, name, funds, generation, msg)) return false;
+
+    Inventory* newInventory = new Inventory(index);
+    RecipeCatalog* newRecipes = new RecipeCatalog();
+    Snapshot snapshot(newInventory, newRecipes);
+    if (!snapshot.load(copy.data(), copy.size(), msg)){
+        delete newRecipes;
+        delete newInventory;
+        return false;
+    }
+    CatalogLoader* newLoader = new CatalogLoader(newInventory, newRecipes);
+
+    //Replays with the copy standing in for the bar.
+    string oldName = name;
+    float oldFunds = funds;
+    swap(inventory, newInventory);
+    swap(recipes, newRecipes);
+    swap(loader, newLoader);
+
+    bool replayed = applyJournal(msg);
+    if (!replayed){
+        swap(inventory, newInventory);
+        swap(recipes, newRecipes);
+        swap(loader, newLoader);
+        name = oldName;
+        funds = oldFunds;
+    } else {
+        //The planner and history follow the new stock table.
+        RestockPlanner* newPlanner = new RestockPlanner(inventory->getStockTable(), REORDER_POINT, REORDER_QTY);
+        newPlanner->setPolicies(*planner);
+        delete planner;
+        delete history;
+        planner = newPlanner;
+        history = new DemandHistory(inventory->getStockTable(), HISTORY_BUCKETS, BUCKET_ORDERS, SMOOTHING);
+        availability->invalidate();
+    }
 
-        //Next, parses the ingredients.
-        vector<Ingredient*> recipeIngredients = vector<Ingredient*>();
-        for (int i = 3; i < tokens->size(); i++) {
-            string currentItem = tokens->at(i);
+    //Deletes whichever side was not kept.
+    delete newLoader;
+    delete newRecipes;
+    delete newInventory;
+    return replayed;
+}
 
-            //Removes the curly braces.
-            if (i == 3) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '{'), currentItem.end());
-            }
-            if (i == tokens->size() - 1) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '}'), currentItem.end());
+/**
+ * Applies the records left in the journal to the bar.
+ * Stops at the first record that doesn't fit the bar.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool SandwichBar::applyJournal(string* msg) {
+    StockTable* table = inventory->getStockTable();
+    vector<BillItem> items;
+    JournalEntry entry;
+    int replayed = 0;
+
+    while (journal->next(entry)){
+        bool matches = true;
+        float amount = 0;
+        bool parallel;
+        const char* text;
+        size_t size;
+        PriceUpdate update;
+
+        if (entry.type == Journal::ORDER_RECORD || entry.type == Journal::RESTOCK_RECORD){
+            //Checks every slot before touching the stock.
+            matches = Journal::readItems(entry, amount, items);
+            for (int i = 0; matches && i < items.size(); i++){
+                matches = items[i].slot >= 0 && items[i].slot < table->getSize() && items[i].count >= 0;
             }
 
-            //Gets the referenced ingredient.
-            Ingredient* current = inventory->getIngredient(currentItem);
-            if (current == NULL){
-                *msg = "Recipe references non-existent ingredient.";
-
-                delete tokens;
-                return false;
+            if (matches && entry.type == Journal::ORDER_RECORD){
+                matches = table->make(items);
+                if (matches) funds += amount;
+            } else if (matches){
+                for (int i = 0; i < items.size(); i++) table->addStock(items[i].slot, items[i].count);
+                funds -= amount;
             }
-
-            recipeIngredients.push_back(current);
-        }
-
-        //Creates the recipe.
-        recipeList->push_back(new Recipe(tokens->at(1), recipeIngredients,
-                                         stof(tokens->at(2))));
-    } else if (tokens->at(0).compare(COMPLEX) == 0){
-        //Perform sanity check.
-        if (tokens->size() < 6){
-            *msg = "Invalid RECIPE command.";
-
-            delete tokens;
-            return false;
-        } else if ((tokens->at(5).compare("{}") == 0
-                    || tokens->at(5).compare("{ }") == 0) &&
-                   (tokens->at(4).compare("{}") == 0
-                    || tokens->at(4).compare("{ }") == 0)){
-            *msg = "Invalid RECIPE command.";
-
-            delete tokens;
-            return false;
+        } else if (entry.type == Journal::INGREDIENT_RECORD){
+            matches = loader->addIngredientLine(StringRef(entry.data, entry.size), msg);
+        } else if (entry.type == Journal::RECIPE_RECORD){
+            matches = loader->addRecipeLine(StringRef(entry.data, entry.size), msg);
+        } else if (entry.type == Journal::CATALOG_RECORD){
+            //The load is replayed even if it failed the first time.
+            matches = Journal::readCatalog(entry, parallel, text, size);
+            if (matches) applyCatalog(text, size, parallel, 0, msg);
+        } else if (entry.type == Journal::PRICE_RECORD){
+            matches = loader->loadPrices(entry.data, entry.size, update, msg);
+            if (matches) update.apply();
+        } else {
+            matches = false;
         }
 
-        //Next, we add the base recipe.
-        Recipe* baseRecipe = findRecipe(tokens->at(2));
-        if (baseRecipe == NULL){
-            *msg = "Base recipe does not exist.";
-
-            delete tokens;
+        if (!matches){
+            *msg = "Journal does not match the bar after " + to_string(replayed) + " records.";
             return false;
         }
+        replayed++;
+    }
 
-        //Iterate through the additions.
-        vector<Ingredient*> additions = vector<Ingredient*>();
-        bool contAdd = true;
-        int i = 4;
-        string ending = "}";
-        while(contAdd){
-            //Check if we have a } brace.
-            string currentItem = tokens->at(i);
-            if (currentItem.compare(
-                    currentItem.length() - ending.length(), ending.length(), ending) == 0){
-                contAdd = false;
-            }
-
-            //Checks whether we have an ending.
-            if (tokens->at(i).compare("{}") == 0
-                || tokens->at(i).compare("{ }") == 0){
-                break;
-            }
-
-            //Removes the curly braces.
-            if (i == 4) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '{'), currentItem.end());
-            }
-            if (contAdd == false) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '}'), currentItem.end());
-            }
-
-            //Gets the referenced ingredient.
-            Ingredient* current = inventory->getIngredient(currentItem);
-            if (current == NULL){
-                *msg = "Recipe references non-existent ingredient.";
-
-                delete tokens;
-                return false;
-            }
-
-            additions.push_back(current);
-            i++;
-        }
-
-        //Iterate through the removals
-        vector<Ingredient*> removals = vector<Ingredient*>();
-        contAdd = true;
-        bool first = true;
-        while(contAdd){
-            //Check if we have a } brace.
-            string currentItem = tokens->at(i);
-            if (currentItem.compare(
-                    currentItem.length() - ending.length(), ending.length(), ending) == 0){
-                contAdd = false;
-            }
-
-            //Checks whether we have an ending.
-            if (tokens->at(i).compare("{}") == 0
-                || tokens->at(i).compare("{ }") == 0){
-                break;
-            }
-
-            //Removes the curly braces.
-            if (first) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '{'), currentItem.end());
-                first = false;
-            }
-            if (i == tokens->size() - 1) {
-                currentItem.erase(
-                        remove(currentItem.begin(),
-                               currentItem.end(), '}'), currentItem.end());
-            }
-
-            //Gets the referenced ingredient.
-            Ingredient* current = inventory->getIngredient(currentItem);
-            if (current == NULL){
-                *msg = "Recipe references non-existent ingredient.";
-
-                delete tokens;
-                return false;
-            }
+    return true;
+}
 
-            removals.push_back(current);
-            i++;
-        }
+/**
+ * Reports why the journal is being closed and stops
+ * logging to it.
+ * @param msg The reason the journal is closed.
+ */
+void SandwichBar::closeJournal(const string& msg) {
+    cout << msg << endl;
+    cout << "Journal closed!" << endl;
 
-        //Creates the recipe.
-        recipeList->push_back(new ComplexRecipe(tokens->at(1),
-                                                additions, baseRecipe,
-                                                removals, stof(tokens->at(3))));
-    } else {
-        *msg = "Unknown RECIPE command.";
+    delete journal;
+    journal = NULL;
+}
 
-        delete tokens;
-        return false;
-    }
+/**
+ * Picks the generation of the next snapshot. Based on
+ * the clock so snapshots of different bars don't share
+ * one, but always after the current generation.
+ * @return The next snapshot generation.
+ */
+uint64_t SandwichBar::nextGeneration() {
+    uint64_t now = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::system_clock::now().time_since_epoch()).count();
 
-    delete tokens;
-    return true;
+    return now > generation ? now : generation + 1;
 }
 
 /**
- * Helper method which finds a recipe by name.
- * @param recipeName The name of the recipe.
- * @return A pointer to the recipe.
+ * Prints the header that is shown when the
+ * program is started.
  */
-Recipe* SandwichBar::findRecipe(string recipeName){
-    //Goes through each recipe and looks.
-    for (int i = 0; i < recipeList->size(); i++){
-        if (recipeName.compare(recipeList->at(i)->getName()) == 0){
-            return recipeList->at(i);
-        }
-    }
+void SandwichBar::printHeader(){
+    string header = "------------------------------------------------------\n";
+    header += "| Sandwich Bar v0.1                                  |\n";
+    header += "| C++ Version                                        |\n";
+    header += "|                                                    |\n";
+    header += "| University of Waterloo, 2016                       |\n";
+    header += "------------------------------------------------------\n";
 
-    return NULL;
+    //Prints the header.
+    cout << header;
 }
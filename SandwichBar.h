@@ -14,7 +14,16 @@
 #include "Customers/Sandwich.h"
 #include "Customers/Order.h"
 #include "Capital/Recipe.h"
+#include "Capital/RecipeCatalog.h"
+#include "Capital/MenuAvailability.h"
+#include "Capital/RestockPlanner.h"
+#include "Capital/DemandHistory.h"
 #include "FoodItems/Inventory.h"
+#include "Storage/CatalogLoader.h"
+#include "Storage/Journal.h"
+#include "Simulation/SimulationStats.h"
+#include "Simulation/MonteCarlo.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -28,6 +37,19 @@ public:
     /** Driver Methods */
     void handleCommands();
 
+    /** Menu Methods */
+    void getMakeableRecipes(std::vector<unsigned int>& bitmap);
+
+    /** Headless Methods */
+    bool loadFile(std::string filename);
+    bool loadFileParallel(std::string filename, int numThreads);
+    bool loadSnapshot(std::string filename);
+    bool saveSnapshot(std::string filename);
+    bool updatePrices(std::string filename);
+    bool openJournal(std::string filename, int syncInterval);
+    SimulationStats runSimulation(const SimulationSettings& settings);
+    MonteCarloStats runMonteCarlo(const SimulationSettings& settings, int numReplicas, int numThreads);
+
     /** Global Variables */
     static int numItems;
 
@@ -35,32 +57,47 @@ private:
     /** Private Variables */
     std::string name;
     float funds;
-    std::vector<Recipe*>* recipeList;
+    RecipeCatalog* recipes;
+    MenuAvailability* availability;
     Inventory* inventory;
+    ReferenceIndex* index;
+    RestockPlanner* planner;
+    DemandHistory* history;
+    CatalogLoader* loader;
+    Journal* journal;
+    uint64_t generation;
     std::string username;
 
     /** Command Methods */
     void setupBar(std::string name, float funds);
     void printHelp();
-    void simulate(int numOrders);
+    void simulate(int numOrders, unsigned int seed);
+    void monteCarlo();
     void takeOrder();
     std::string getRecipes();
+    std::string getAvailable();
     void lookup();
+    void impact();
     void addRecipe();
     void addIngredient();
     void printDetails();
     void changeName();
     void load();
+    void restore();
+    void save();
+    void prices();
+    void recover();
+    void restock();
+    void forecast();
 
     /** Helper Methods */
     void printHeader();
-    std::vector<std::string>* tokenize(std::string line);
-    Order* generateRandOrder();
-    Sandwich* generateRandSandwich();
-    bool orderMore(Order* currentOrder);
-    bool addIngredientLine(std::string line, std::string* msg);
-    bool addRecipeLine(std::string line, std::string* msg);
-    Recipe* findRecipe(std::string recipeName);
+    bool loadCatalog(std::string filename, bool parallel, int numThreads);
+    bool applyCatalog(const char* data, size_t size, bool parallel, int numThreads, std::string* msg);
+    bool replayJournal(std::string* msg);
+    bool applyJournal(std::string* msg);
+    void closeJournal(const std::string& msg);
+    uint64_t nextGeneration();
 
     /** Command Constants */
     const std::string HELP = "help";
@@ -69,19 +106,21 @@ private:
     const std::string DETS = "details";
     const std::string CHANGE = "change name";
     const std::string RECIPES = "recipes";
+    const std::string AVAIL = "available";
     const std::string SIM = "simulate";
+    const std::string MONTE = "monte carlo";
     const std::string LOAD = "load";
+    const std::string RESTORE = "load snapshot";
+    const std::string SAVE = "save snapshot";
+    const std::string PRICES = "update prices";
+    const std::string JOURNAL = "open journal";
     const std::string EXIT = "quit";
     const std::string ADD_I = "add ingredient";
     const std::string ADD_R = "add recipe";
     const std::string LOOKUP = "lookup";
-
-    /** Load Flags */
-    const std::string BAR_FLAG = "BAR";
-    const std::string ING_FLAG = "INGREDIENT";
-    const std::string RECIPE_FLAG = "RECIPE";
-    const std::string SIMPLE = "simple";
-    const std::string COMPLEX = "complex";
+    const std::string IMPACT = "impact";
+    const std::string RESTOCK = "restock";
+    const std::string FORECAST = "forecast";
 
     /** Default Sandwich Bar Constants */
     const std::string DEFAULT_NAME = "Defacto's Sandwich Bar";
@@ -89,23 +128,18 @@ private:
 
     /** Simulation Constants */
     const int ORD_MAX = 10000;
+    const int REP_MAX = 100000;
     const int SAND_MAX = 10;
     const int SUB_MAX = 2;
-    const int ING_FACTOR = 10;
-    std::string names[12] = {
-            "Bryan",
-            "Nancy",
-            "Jeff",
-            "Hillary",
-            "Rick",
-            "Erin",
-            "Greg",
-            "Sarah",
-            "Duncan",
-            "Mabel",
-            "Robbie",
-            "Beth"
-    };
+
+    /** Restock Constants */
+    const int REORDER_POINT = 10;
+    const int REORDER_QTY = 10;
+
+    /** Forecast Constants */
+    const int HISTORY_BUCKETS = 8;
+    const int BUCKET_ORDERS = 100;
+    const float SMOOTHING = 0.3;
 };
 
 #endif //SANDWICH_BAR_SANDWICHBAR_H
@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MonteCarlo.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Runs many independent replicas of the sandwich bar in parallel and
+// reports how the results are distributed. Every replica gets its own
+// copy of the stock and funds and its own stream of random orders.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include "MonteCarlo.h"
+#include "Simulator.h"
+
+using namespace std;
+
+/**
+ * Creates empty Monte Carlo statistics.
+ */
+MonteCarloStats::MonteCarloStats(){
+    replicas = 0;
+    threads = 0;
+    ordersPerReplica = 0;
+    revenueP50 = 0;
+    revenueP95 = 0;
+    fundsP50 = 0;
+    fundsP5 = 0;
+    bankruptcy = 0;
+    seconds = 0;
+}
+
+/**
+ * Prints the distributions as a report.
+ * @return String containing the report.
+ */
+string MonteCarloStats::print(){
+    stringstream text;
+    text << fixed << setprecision(2);
+
+    text << "MONTE CARLO RESULTS\n";
+    text << "----------------------------------\n";
+    text << "Replicas: " << replicas << " (" << threads << " threads)\n";
+    text << "Orders per Replica: " << ordersPerReplica << "\n";
+    text << "Replicas/sec: " << (seconds > 0 ? replicas / seconds : 0) << "\n";
+    text << "Revenue P50: $" << revenueP50 << "\n";
+    text << "Revenue P95: $" << revenueP95 << "\n";
+    text << "Final Funds P5: $" << fundsP5 << "\n";
+    text << "Final Funds P50: $" << fundsP50 << "\n";
+    text << "Bankruptcy Probability: " << bankruptcy * 100 << "%\n";
+
+    //Prints how often each ingredient ran out.
+    text << "\nSTOCKOUTS PER INGREDIENT\n";
+    text << "----------------------------------\n";
+    for (int i = 0; i < slotNames.size(); i++){
+        text << slotNames.at(i) << ": " << slotStockoutRate.at(i) * 100 << "% of replicas, "
+             << slotStockoutMean.at(i) << " per replica\n";
+    }
+
+    return text.str();
+}
+
+/**
+ * Creates a Monte Carlo driver for the current state
+ * of a sandwich bar. The bar itself is never changed.
+ * @param inventory The inventory every replica is copied from.
+ * @param recipes The recipes the orders can use.
+ * @param funds The starting funds of every replica.
+ */
+MonteCarlo::MonteCarlo(Inventory* inventory, RecipeCatalog* recipes, float funds){
+    this->inventory = inventory;
+    this->recipes = recipes;
+    this->funds = funds;
+    policies = NULL;
+    nextReplica = 0;
+}
+
+/**
+ * Default destructor. Nothing is owned.
+ */
+MonteCarlo::~MonteCarlo(){ }
+
+/**
+ * Sets the reorder points and quantities every replica
+ * restocks with. The planner must outlive the run.
+ * @param policies The planner to copy the policies from.
+ */
+void MonteCarlo::setRestockPolicy(const RestockPlanner* policies){
+    this->policies = policies;
+}
+
+/**
+ * Runs every replica and gathers the distributions.
+ * Replicas are handed out to the threads one at a time
+ * so uneven runs (bankruptcies) don't idle any cores.
+ * @param settings The settings used by every replica.
+ * @param numReplicas The number of replicas to run.
+ * @param numThreads The number of threads or 0 for every core.
+ * @return The distributions over all replicas.
+ */
+MonteCarloStats MonteCarlo::run(const SimulationSettings& settings, int numReplicas, int numThreads){
+    MonteCarloStats stats;
+    if (numReplicas < 1 || recipes->getSize() == 0) return stats;
+
+    if (numThreads < 1) numThreads = thread::hardware_concurrency();
+    if (numThreads < 1) numThreads = 1;
+    if (numThreads > numReplicas) numThreads = numReplicas;
+
+    //Compile the recipes and costs before any thread reads them.
+    for (int i = 0; i < recipes->getSize(); i++){
+        recipes->getRecipe(i)->getBill();
+        recipes->getRecipe(i)->getTotalCost();
+    }
+    for (int i = 0; i < inventory->getInventorySize(); i++){
+        inventory->getIngredient(i)->getCost();
+    }
+
+    //Every replica forks its own stream from this generator.
+    OrderGenerator parent(recipes, inventory, settings.seed);
+    parent.setPopularity(settings.popularity);
+    parent.setSubstitutionRate(settings.substitutionRate);
+    parent.setMaxSandwiches(settings.maxSandwiches);
+    parent.setMaxSubstitutions(settings.maxSubstitutions);
+
+    results.assign(numReplicas, SimulationStats());
+    nextReplica = 0;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int i = 0; i < numThreads; i++){
+        workers.push_back(thread(&MonteCarlo::work, this, &parent, settings.numOrders));
+    }
+    for (int i = 0; i < workers.size(); i++){
+        workers.at(i).join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    //Gathers the distributions.
+    int numSlots = inventory->getStockTable()->getSize();
+    vector<double> revenue;
+    vector<double> finalFunds;
+    int bankrupt = 0;
+    stats.slotStockoutRate.assign(numSlots, 0);
+    stats.slotStockoutMean.assign(numSlots, 0);
+
+    for (int i = 0; i < results.size(); i++){
+        revenue.push_back(results.at(i).revenue);
+        finalFunds.push_back(results.at(i).finalFunds);
+        if (results.at(i).bankruptAt != -1) bankrupt++;
+
+        for (int j = 0; j < numSlots; j++){
+            long long count = results.at(i).slotStockouts.at(j);
+            if (count > 0) stats.slotStockoutRate.at(j)++;
+            stats.slotStockoutMean.at(j) += count;
+        }
+    }
+
+    for (int j = 0; j < numSlots; j++){
+        stats.slotNames.push_back(inventory->getSlotName(j));
+        stats.slotStockoutRate.at(j) /= numReplicas;
+        stats.slotStockoutMean.at(j) /= numReplicas;
+    }
+
+    stats.replicas = numReplicas;
+    stats.threads = numThreads;
+    stats.ordersPerReplica = settings.numOrders;
+    stats.revenueP50 = percentile(revenue, 0.50);
+    stats.revenueP95 = percentile(revenue, 0.95);
+    stats.fundsP5 = percentile(finalFunds, 0.05);
+    stats.fundsP50 = percentile(finalFunds, 0.50);
+    stats.bankruptcy = (double) bankrupt / numReplicas;
+    stats.seconds = elapsed.count();
+
+    results.clear();
+    return stats;
+}
+
+/**
+ * Runs replicas until there are none left. Each replica
+ * copies the stock table and funds so nothing is shared
+ * but the recipes, which are only read.
+ * @param parent The generator every replica forks from.
+ * @param numOrders The number of orders per replica.
+ */
+void MonteCarlo::work(const OrderGenerator* parent, long long numOrders){
+    int replica;
+    while ((replica = nextReplica++) < results.size()){
+        StockTable table(*inventory->getStockTable());
+        OrderGenerator generator(*parent, replica);
+
+        Simulator simulator(&table, &generator, funds);
+        if (policies != NULL) simulator.setRestockPolicy(*policies);
+        results.at(replica) = simulator.run(numOrders);
+    }
+}
+
+/**
+ * Gets a percentile using the nearest rank.
+ * @param values The values to rank. These get sorted.
+ * @param rank The rank between 0 and 1.
+ * @return The value at that rank.
+ */
+double MonteCarlo::percentile(vector<double>& values, double rank){
+    if (values.size() == 0) return 0;
+    sort(values.begin(), values.end());
+
+    int index = (int) ceil(rank * values.size()) - 1;
+    if (index < 0) index = 0;
+    if (index >= values.size()) index = values.size() - 1;
+
+    return values.at(index);
+}
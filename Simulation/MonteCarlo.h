@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MonteCarlo.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Runs many independent replicas of the sandwich bar in parallel and
+// reports how the results are distributed. Every replica gets its own
+// copy of the stock and funds and its own stream of random orders.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_MONTECARLO_H
+#define SANDWICH_BAR_MONTECARLO_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "OrderGenerator.h"
+#include "SimulationStats.h"
+#include "../Capital/RecipeCatalog.h"
+#include "../Capital/RestockPlanner.h"
+#include "../FoodItems/Inventory.h"
+
+struct MonteCarloStats {
+    /** Constructor */
+    MonteCarloStats();
+
+    /** Print Methods */
+    std::string print();
+
+    /** Statistics */
+    int replicas;
+    int threads;
+    long long ordersPerReplica;
+    double revenueP50;
+    double revenueP95;
+    double fundsP50;
+    double fundsP5;
+    double bankruptcy;
+    double seconds;
+    std::vector<std::string> slotNames;
+    std::vector<double> slotStockoutRate;
+    std::vector<double> slotStockoutMean;
+};
+
+class MonteCarlo {
+public:
+    /** Constructor/Destructor */
+    MonteCarlo(Inventory* inventory, RecipeCatalog* recipes, float funds);
+    ~MonteCarlo();
+
+    /** Setting Methods */
+    void setRestockPolicy(const RestockPlanner* policies);
+
+    /** Simulation Methods */
+    MonteCarloStats run(const SimulationSettings& settings, int numReplicas, int numThreads);
+
+private:
+    /** Private Variables */
+    Inventory* inventory;
+    RecipeCatalog* recipes;
+    float funds;
+    const RestockPlanner* policies;
+    std::atomic<int> nextReplica;
+    std::vector<SimulationStats> results;
+
+    /** Helper Methods */
+    void work(const OrderGenerator* parent, long long numOrders);
+    static double percentile(std::vector<double>& values, double rank);
+};
+
+
+#endif //SANDWICH_BAR_MONTECARLO_H
@@ -0,0 +1,221 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderGenerator.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Generates random orders for simulating the sandwich bar. Every
+// generator owns its own seeded random engine so runs can be repeated
+// exactly and each thread can be given its own independent stream.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include "OrderGenerator.h"
+
+using namespace std;
+
+/**
+ * Creates a generator with its own seeded engine. By default
+ * recipes are equally popular, half of the sandwiches have a
+ * substitution and orders hold one to ten sandwiches.
+ * @param recipes The recipes to order from.
+ * @param inventory The inventory to substitute from.
+ * @param seed The seed for the random engine.
+ */
+OrderGenerator::OrderGenerator(RecipeCatalog* recipes, Inventory* inventory, unsigned int seed)
+    : engine(seed) {
+    this->recipes = recipes;
+    this->inventory = inventory;
+    this->seed = seed;
+    exponent = 0;
+    substitutionRate = 0.5;
+    maxSandwiches = 10;
+    maxSubstitutions = 2;
+}
+
+/**
+ * Creates an independent generator for another thread. Uses
+ * the same settings as the parent and a stream derived from
+ * the parent's seed, so the results are still repeatable.
+ * @param parent The generator to copy the settings of.
+ * @param stream The stream number of the new generator.
+ */
+OrderGenerator::OrderGenerator(const OrderGenerator& parent, unsigned int stream) {
+    recipes = parent.recipes;
+    inventory = parent.inventory;
+    seed = parent.seed;
+    exponent = parent.exponent;
+    substitutionRate = parent.substitutionRate;
+    maxSandwiches = parent.maxSandwiches;
+    maxSubstitutions = parent.maxSubstitutions;
+    popularity = parent.popularity;
+
+    seed_seq sequence{seed, stream};
+    engine.seed(sequence);
+}
+
+/**
+ * Default destructor.
+ */
+OrderGenerator::~OrderGenerator(){ }
+
+/**
+ * Sets how skewed recipe popularity is. Recipe i is picked
+ * in proportion to 1 / (i + 1)^exponent, so 0 picks evenly
+ * and 1 gives a classic Zipf distribution.
+ * @param exponent The Zipf exponent.
+ */
+void OrderGenerator::setPopularity(double exponent){
+    this->exponent = exponent;
+    popularity.clear();
+}
+
+/**
+ * Sets the chance that a sandwich has a substitution.
+ * @param rate The chance between 0 and 1.
+ */
+void OrderGenerator::setSubstitutionRate(double rate){
+    substitutionRate = rate;
+}
+
+/**
+ * Sets the most sandwiches an order can hold.
+ * Orders hold between one and this many.
+ * @param maximum The maximum number of sandwiches, at least one.
+ */
+void OrderGenerator::setMaxSandwiches(int maximum){
+    maxSandwiches = (maximum < 1 ? 1 : maximum);
+}
+
+/**
+ * Sets the most substitutions a sandwich can have.
+ * A substituted sandwich has at least one.
+ * @param maximum The maximum number of substitutions, at least one.
+ */
+void OrderGenerator::setMaxSubstitutions(int maximum){
+    maxSubstitutions = (maximum < 1 ? 1 : maximum);
+}
+
+/**
+ * Generates a randomized order for one customer.
+ * Prepares a random number of sandwiches and
+ * a random number of substitutions.
+ * @return A pointer to the generated order.
+ */
+Order* OrderGenerator::generateOrder(){
+    return generateOrder(NULL);
+}
+
+/**
+ * Generates a randomized order inside an order arena.
+ * The order must be destroyed in place before the
+ * arena is reset.
+ * @param arena The arena for the order or NULL for the heap.
+ * @return A pointer to the generated order.
+ */
+Order* OrderGenerator::generateOrder(OrderArena* arena){
+    string name = names[nextInt(12)];
+    Order* randomOrder = (arena == NULL) ? new Order(name) : arena->create<Order>(name, arena);
+
+    //Now decides the number of sandwiches.
+    int numSand = nextInt(maxSandwiches) + 1;
+    for (int i = 0; i < numSand; i++){
+        randomOrder->addSandwich(generateSandwich(arena));
+    }
+
+    return randomOrder;
+}
+
+/**
+ * Generates a random sandwich. Picks the recipe by
+ * popularity and then possibly adds a substitution.
+ * @param arena The arena for the sandwich or NULL for the heap.
+ * @return A pointer to the generated sandwich.
+ */
+Sandwich* OrderGenerator::generateSandwich(OrderArena* arena){
+    Recipe* decidedRecipe = recipes->getRecipe(generateRecipeId());
+
+    //Now we decide if we need a substitution.
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    if (chance(engine) >= substitutionRate){
+        if (arena == NULL) return new Sandwich(decidedRecipe);
+        return arena->create<Sandwich>(decidedRecipe, (Substitution*) NULL, arena);
+    }
+
+    //Generate a substitution.
+    Substitution* substitution = (arena == NULL) ? new Substitution() : arena->create<Substitution>(arena);
+    const vector<Ingredient*>& ingredients = decidedRecipe->getIngredients();
+    IngredientList adds((ArenaAllocator<Ingredient*>(arena)));
+    IngredientList removes((ArenaAllocator<Ingredient*>(arena)));
+
+    //Goes through and substitutes.
+    int numSubs = nextInt(maxSubstitutions) + 1;
+    for (int i = 0; i < numSubs; i++){
+        if (nextInt(2) == 1){
+            //Try a few ingredients that are not in the recipe yet.
+            for (int j = 0; j < ADD_ATTEMPTS; j++){
+                Ingredient* ing = inventory->getRandomIngredient(engine);
+                if (ing == NULL) break;
+                if (find(ingredients.begin(), ingredients.end(), ing) == ingredients.end() &&
+                    find(adds.begin(), adds.end(), ing) == adds.end()){
+                    adds.push_back(ing);
+                    substitution->addAddition(ing);
+                    break;
+                }
+            }
+        } else if (removes.size() < ingredients.size()) {
+            //Pick a random ingredient that was not removed yet.
+            Ingredient* removed = ingredients.at(nextInt(ingredients.size()));
+            while (find(removes.begin(), removes.end(), removed) != removes.end()){
+                removed = ingredients.at(nextInt(ingredients.size()));
+            }
+
+            removes.push_back(removed);
+            substitution->addRemoval(removed);
+        }
+    }
+
+    if (arena == NULL) return new Sandwich(decidedRecipe, substitution);
+    return arena->create<Sandwich>(decidedRecipe, substitution, arena);
+}
+
+/**
+ * Picks a recipe id according to the popularity setting.
+ * @return The id of the picked recipe.
+ */
+int OrderGenerator::generateRecipeId(){
+    if (exponent == 0) return nextInt(recipes->getSize());
+    if (popularity.size() != recipes->getSize()) buildPopularity();
+
+    //Search the cumulative weights.
+    uniform_real_distribution<double> pick(0.0, popularity.back());
+    int id = upper_bound(popularity.begin(), popularity.end(), pick(engine)) - popularity.begin();
+
+    return id < popularity.size() ? id : popularity.size() - 1;
+}
+
+/**
+ * Gets a random number below a bound.
+ * @param bound The exclusive upper bound.
+ * @return The random number or 0 if the bound is below one.
+ */
+int OrderGenerator::nextInt(int bound){
+    if (bound < 1) return 0;
+
+    uniform_int_distribution<int> distribution(0, bound - 1);
+    return distribution(engine);
+}
+
+/**
+ * Builds the cumulative weights used for picking recipes.
+ */
+void OrderGenerator::buildPopularity(){
+    popularity.clear();
+
+    double total = 0;
+    for (int i = 0; i < recipes->getSize(); i++){
+        total += 1.0 / pow(i + 1, exponent);
+        popularity.push_back(total);
+    }
+}
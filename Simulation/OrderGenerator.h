@@ -0,0 +1,76 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderGenerator.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Generates random orders for simulating the sandwich bar. Every
+// generator owns its own seeded random engine so runs can be repeated
+// exactly and each thread can be given its own independent stream.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_ORDERGENERATOR_H
+#define SANDWICH_BAR_ORDERGENERATOR_H
+
+#include <random>
+#include <string>
+#include <vector>
+#include "../Customers/Order.h"
+#include "../Capital/RecipeCatalog.h"
+#include "../FoodItems/Inventory.h"
+
+class OrderGenerator {
+public:
+    /** Constructors/Destructor */
+    OrderGenerator(RecipeCatalog* recipes, Inventory* inventory, unsigned int seed);
+    OrderGenerator(const OrderGenerator& parent, unsigned int stream);
+    ~OrderGenerator();
+
+    /** Setting Methods */
+    void setPopularity(double exponent);
+    void setSubstitutionRate(double rate);
+    void setMaxSandwiches(int maximum);
+    void setMaxSubstitutions(int maximum);
+
+    /** Generate Methods */
+    Order* generateOrder();
+    Order* generateOrder(OrderArena* arena);
+    Sandwich* generateSandwich(OrderArena* arena);
+    int generateRecipeId();
+
+private:
+    /** Private Variables */
+    RecipeCatalog* recipes;
+    Inventory* inventory;
+    unsigned int seed;
+    std::mt19937 engine;
+    double exponent;
+    double substitutionRate;
+    int maxSandwiches;
+    int maxSubstitutions;
+    std::vector<double> popularity;
+
+    /** Helper Methods */
+    int nextInt(int bound);
+    void buildPopularity();
+
+    /** Generator Constants */
+    const int ADD_ATTEMPTS = 16;
+    std::string names[12] = {
+            "Bryan",
+            "Nancy",
+            "Jeff",
+            "Hillary",
+            "Rick",
+            "Erin",
+            "Greg",
+            "Sarah",
+            "Duncan",
+            "Mabel",
+            "Robbie",
+            "Beth"
+    };
+};
+
+
+#endif //SANDWICH_BAR_ORDERGENERATOR_H
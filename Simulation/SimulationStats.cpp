@@ -0,0 +1,55 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SimulationStats.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Settings used to run a simulation and the aggregated statistics
+// gathered while running it. Used instead of printing every order
+// when running large simulations.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <sstream>
+#include "SimulationStats.h"
+
+using namespace std;
+
+/**
+ * Creates empty statistics. A bankruptcy point
+ * of -1 means the bar never went bankrupt.
+ */
+SimulationStats::SimulationStats(){
+    orders = 0;
+    sandwiches = 0;
+    stockouts = 0;
+    bankruptAt = -1;
+    revenue = 0;
+    restockSpend = 0;
+    finalFunds = 0;
+    seconds = 0;
+}
+
+/**
+ * Prints the statistics as a report.
+ * @return String containing the report.
+ */
+string SimulationStats::print(){
+    stringstream text;
+    text << fixed << setprecision(2);
+
+    text << "SIMULATION RESULTS\n";
+    text << "----------------------------------\n";
+    text << "Orders: " << orders << "\n";
+    text << "Sandwiches: " << sandwiches << "\n";
+    text << "Orders/sec: " << (seconds > 0 ? orders / seconds : 0) << "\n";
+    text << "Revenue: $" << revenue << "\n";
+    text << "Stockouts: " << stockouts << "\n";
+    text << "Restock Spend: $" << restockSpend << "\n";
+    text << "Final Funds: $" << finalFunds << "\n";
+
+    if (bankruptAt == -1) text << "Bankruptcy Point: None\n";
+    else text << "Bankruptcy Point: Order " << bankruptAt << "\n";
+
+    return text.str();
+}
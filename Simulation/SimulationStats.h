@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SimulationStats.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Settings used to run a simulation and the aggregated statistics
+// gathered while running it. Used instead of printing every order
+// when running large simulations.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_SIMULATIONSTATS_H
+#define SANDWICH_BAR_SIMULATIONSTATS_H
+
+#include <string>
+#include <vector>
+
+struct SimulationSettings {
+    long long numOrders;
+    unsigned int seed;
+    double popularity;
+    double substitutionRate;
+    int maxSandwiches;
+    int maxSubstitutions;
+    bool verbose;
+};
+
+struct SimulationStats {
+    /** Constructor */
+    SimulationStats();
+
+    /** Print Methods */
+    std::string print();
+
+    /** Statistics */
+    long long orders;
+    long long sandwiches;
+    long long stockouts;
+    long long bankruptAt;
+    double revenue;
+    double restockSpend;
+    double finalFunds;
+    double seconds;
+    std::vector<long long> slotStockouts;
+};
+
+
+#endif //SANDWICH_BAR_SIMULATIONSTATS_H
@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Simulator.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Runs the order loop of a simulation against a stock table and a
+// pot of funds. Orders more stock when an order can't be made and
+// keeps aggregated statistics. Can print every order as it goes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include "Simulator.h"
+
+using namespace std;
+
+/**
+ * Creates a simulator. Nothing is printed or recorded
+ * and ten of each short ingredient is ordered by default.
+ * @param table The stock table to make orders from.
+ * @param generator The generator creating the orders.
+ * @param funds The starting funds.
+ */
+Simulator::Simulator(StockTable* table, OrderGenerator* generator, float funds)
+    : planner(table, 10, 10) {
+    this->table = table;
+    this->generator = generator;
+    this->funds = funds;
+    out = NULL;
+    history = NULL;
+    journal = NULL;
+}
+
+/**
+ * Default destructor. Nothing is owned.
+ */
+Simulator::~Simulator(){ }
+
+/**
+ * Sets where every order is printed.
+ * @param out The stream to print to or NULL for none.
+ */
+void Simulator::setOutput(ostream* out){
+    this->out = out;
+}
+
+/**
+ * Sets the reorder points and quantities used when
+ * an order can't be made.
+ * @param policies The planner to copy the policies from.
+ */
+void Simulator::setRestockPolicy(const RestockPlanner& policies){
+    planner.setPolicies(policies);
+}
+
+/**
+ * Sets where the use of every made order is recorded.
+ * @param history The history to record in or NULL for none.
+ */
+void Simulator::setHistory(DemandHistory* history){
+    this->history = history;
+}
+
+/**
+ * Sets where every made order and restock is logged.
+ * @param journal The journal to log to or NULL for none.
+ */
+void Simulator::setJournal(Journal* journal){
+    this->journal = journal;
+}
+
+/**
+ * Simulates the bar for a number of orders. Stops early
+ * if the bar can't afford to order more stock.
+ * @param numOrders The number of orders to simulate.
+ * @return The statistics of the run.
+ */
+SimulationStats Simulator::run(long long numOrders){
+    SimulationStats stats;
+    stats.slotStockouts.assign(table->getSize(), 0);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (long long i = 0; i < numOrders; i++){
+        //First, generates an order.
+        Order* currentOrder = generator->generateOrder(&arena);
+        if (out != NULL) *out << currentOrder->printOrder() << endl;
+
+        //Works out everything the order needs.
+        bill.clear();
+        currentOrder->appendBill(bill);
+        bill.compact();
+
+        //Perform order logic.
+        if (!table->make(bill)){
+            if (out != NULL) *out << "Not enough ingredients are available. Ordering more...\n" << endl;
+            stats.stockouts++;
+
+            //Order more. And then order again.
+            if (!restock(stats)){
+                stats.bankruptAt = i;
+                releaseOrder(currentOrder);
+                break;
+            }
+            table->make(bill);
+        }
+
+        if (out != NULL){
+            *out << "Order was successful.\n";
+            if (i + 1 < numOrders) *out << endl;
+        }
+
+        if (history != NULL) history->record(bill);
+        if (journal != NULL) journal->logOrder(bill, currentOrder->getTotalCost());
+
+        //Receive payment.
+        stats.orders++;
+        stats.sandwiches += currentOrder->getSandwichCount();
+        stats.revenue += currentOrder->getTotalCost();
+        funds += currentOrder->getTotalCost();
+        releaseOrder(currentOrder);
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    stats.seconds = elapsed.count();
+    stats.finalFunds = funds;
+
+    return stats;
+}
+
+/**
+ * Gets the funds left after the simulation.
+ * @return The funds.
+ */
+float Simulator::getFunds(){
+    return funds;
+}
+
+/**
+ * Restocks for the current bill in one purchase and
+ * records every ingredient that ran out.
+ * @param stats The statistics to record the spend in.
+ * @return Boolean indicating whether it could be afforded.
+ */
+bool Simulator::restock(SimulationStats& stats){
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        if (items[i].count > table->getQuantity(items[i].slot)) stats.slotStockouts[items[i].slot]++;
+    }
+
+    //Plan and buy everything the order is short on.
+    planner.clearDemand();
+    planner.addDemand(bill);
+    planner.plan();
+    if (!planner.purchase(funds)) return false;
+    if (journal != NULL) journal->logRestock(planner.getPurchases(), planner.getCost());
+
+    stats.restockSpend += planner.getCost();
+    return true;
+}
+
+/**
+ * Frees an order and everything in it at once by
+ * destroying it in place and resetting the arena.
+ * @param order The order to free.
+ */
+void Simulator::releaseOrder(Order* order){
+    order->~Order();
+    arena.reset();
+}
@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Simulator.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Runs the order loop of a simulation against a stock table and a
+// pot of funds. Orders more stock when an order can't be made and
+// keeps aggregated statistics. Can print every order as it goes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_SIMULATOR_H
+#define SANDWICH_BAR_SIMULATOR_H
+
+#include <ostream>
+#include "OrderGenerator.h"
+#include "SimulationStats.h"
+#include "../FoodItems/StockTable.h"
+#include "../Capital/RestockPlanner.h"
+#include "../Capital/DemandHistory.h"
+#include "../Storage/Journal.h"
+
+class Simulator {
+public:
+    /** Constructor/Destructor */
+    Simulator(StockTable* table, OrderGenerator* generator, float funds);
+    ~Simulator();
+
+    /** Setting Methods */
+    void setOutput(std::ostream* out);
+    void setRestockPolicy(const RestockPlanner& policies);
+    void setHistory(DemandHistory* history);
+    void setJournal(Journal* journal);
+
+    /** Simulation Methods */
+    SimulationStats run(long long numOrders);
+    float getFunds();
+
+private:
+    /** Private Variables */
+    StockTable* table;
+    OrderGenerator* generator;
+    std::ostream* out;
+    float funds;
+    RestockPlanner planner;
+    DemandHistory* history;
+    Journal* journal;
+    BillOfMaterials bill;
+    OrderArena arena;
+
+    /** Helper Methods */
+    bool restock(SimulationStats& stats);
+    void releaseOrder(Order* order);
+};
+
+
+#endif //SANDWICH_BAR_SIMULATOR_H
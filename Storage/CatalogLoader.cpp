@@ -0,0 +1,896 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CatalogLoader.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Parses the BAR, INGREDIENT and RECIPE sections of a catalog straight
+// out of a memory-mapped buffer. Tokens are views into the buffer so
+// only the final ingredients and recipes are allocated.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <limits.h>
+#include <string.h>
+#include <functional>
+#include <queue>
+#include <thread>
+#include "CatalogLoader.h"
+#include "../Capital/ComplexRecipe.h"
+
+using namespace std;
+
+const int CatalogLoader::NO_SECTION;
+const int CatalogLoader::FLAG_LINE;
+const int CatalogLoader::BAR_SECTION;
+const int CatalogLoader::ING_SECTION;
+const int CatalogLoader::RECIPE_SECTION;
+
+/**
+ * Creates a loader that adds to an inventory
+ * and a recipe catalog.
+ * @param inventory The inventory to add ingredients to.
+ * @param recipes The catalog to add recipes to.
+ */
+CatalogLoader::CatalogLoader(Inventory* inventory, RecipeCatalog* recipes){
+    this->inventory = inventory;
+    this->recipes = recipes;
+    barSet = false;
+    funds = 0;
+    errorLine = INT_MAX;
+}
+
+/**
+ * Default destructor. Nothing is owned.
+ */
+CatalogLoader::~CatalogLoader(){ }
+
+/**
+ * Loads a whole catalog from a buffer. Stops at the
+ * first bad line, keeping everything added before it.
+ * @param data The catalog text.
+ * @param size The number of characters.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool CatalogLoader::load(const char* data, size_t size, string* msg){
+    int lineNum = 0;
+    bool barFlag = false;
+    bool ingFlag = false;
+    bool recipeFlag = false;
+    barSet = false;
+
+    const char* current = data;
+    const char* end = data + size;
+    while (current < end){
+        //Cuts the next line out of the buffer.
+        const char* newline = (const char*) memchr(current, '\n', end - current);
+        const char* lineEnd = (newline == NULL) ? end : newline;
+        StringRef line(current, lineEnd - current);
+        current = (newline == NULL) ? end : newline + 1;
+        lineNum++;
+
+        if (line.endsWith('\r')) line.length--;
+
+        //Checks for blank characters.
+        if (line.startsWith("//") || line.length == 0)
+            continue;
+
+        //Checks what line we are dealing with.
+        string error;
+        int kind = checkLine(line, &barFlag, &ingFlag, &recipeFlag, &error);
+        if (kind == RECIPE_SECTION){
+            addRecipeLine(line, &error);
+        } else if (kind == ING_SECTION){
+            addIngredientLine(line, &error);
+        } else if (kind == BAR_SECTION){
+            addBarLine(line, &error);
+        } else if (kind == NO_SECTION){
+            *msg = "Unknown error encountered at line " + to_string(lineNum) + ".";
+            return false;
+        }
+
+        //Check for errors.
+        if (!error.empty()){
+            *msg = lineError(lineNum, error);
+            return false;
+        }
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Reads a price file into a batch of price changes. Every
+ * line holds a simple ingredient name and its new cost.
+ * Nothing is added to the batch if any line is bad.
+ * @param data The price file text.
+ * @param size The number of characters.
+ * @param update The batch to add the changes to.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool CatalogLoader::loadPrices(const char* data, size_t size, PriceUpdate& update, string* msg){
+    vector<SimpleIngredient*> changes;
+    vector<float> costs;
+    int lineNum = 0;
+
+    const char* current = data;
+    const char* end = data + size;
+    while (current < end){
+        //Cuts the next line out of the buffer.
+        const char* newline = (const char*) memchr(current, '\n', end - current);
+        const char* lineEnd = (newline == NULL) ? end : newline;
+        StringRef line(current, lineEnd - current);
+        current = (newline == NULL) ? end : newline + 1;
+        lineNum++;
+
+        if (line.endsWith('\r')) line.length--;
+
+        //Checks for blank characters.
+        if (line.startsWith("//") || line.length == 0)
+            continue;
+
+        //Only simple ingredients have their own price.
+        CatalogEntry entry;
+        string error;
+        if (!parser.parsePrice(line, entry, &error)){
+            *msg = lineError(lineNum, error);
+            return false;
+        }
+
+        SimpleIngredient* ing = dynamic_cast<SimpleIngredient*>(findIngredient(entry.name));
+        if (ing == NULL){
+            *msg = lineError(lineNum, "Price references non-existent simple ingredient.");
+            return false;
+        }
+
+        changes.push_back(ing);
+        costs.push_back(entry.price);
+    }
+
+    for (int i = 0; i < changes.size(); i++){
+        update.addChange(changes.at(i), costs.at(i));
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Loads a whole catalog using several threads. Lines are
+ * split and checked in parallel, then names are resolved
+ * in dependency order, so ingredients and recipes may use
+ * names defined further down the file. Reports the same
+ * error as a normal load would for the earliest bad line,
+ * but adds nothing at all if any line is bad.
+ * @param data The catalog text.
+ * @param size The number of characters.
+ * @param numThreads The number of threads or 0 for every core.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool CatalogLoader::loadParallel(const char* data, size_t size, int numThreads, string* msg){
+    barSet = false;
+    errorLine = INT_MAX;
+    error = "";
+
+    if (numThreads < 1) numThreads = thread::hardware_concurrency();
+    if (numThreads < 1 || size == 0) numThreads = 1;
+
+    //Splits the file into chunks that end on a line.
+    vector<CatalogChunk> chunks(numThreads);
+    const char* current = data;
+    const char* end = data + size;
+    for (int i = 0; i < numThreads; i++){
+        const char* chunkEnd = end;
+        if (i + 1 < numThreads){
+            const char* target = data + (size_t) ((unsigned long long) size * (i + 1) / numThreads);
+            if (target < current) target = current;
+
+            const char* newline = (const char*) memchr(target, '\n', end - target);
+            chunkEnd = (newline == NULL) ? end : newline + 1;
+        }
+
+        chunks[i].start = current;
+        chunks[i].end = chunkEnd;
+        chunks[i].errorLine = INT_MAX;
+        current = chunkEnd;
+    }
+
+    //Finds the lines, then checks their syntax.
+    runChunks(&CatalogLoader::scanChunk, chunks);
+    assignSections(chunks);
+    runChunks(&CatalogLoader::parseChunk, chunks);
+
+    //Gathers the entries in file order.
+    vector<CatalogEntry> bars;
+    vector<CatalogEntry> ingredientEntries;
+    vector<CatalogEntry> recipeEntries;
+    vector<StringRef> items;
+    for (int i = 0; i < chunks.size(); i++){
+        CatalogChunk& chunk = chunks[i];
+        if (chunk.errorLine != INT_MAX) setError(chunk.errorLine, chunk.error);
+
+        int base = items.size();
+        items.insert(items.end(), chunk.items.begin(), chunk.items.end());
+        bars.insert(bars.end(), chunk.bars.begin(), chunk.bars.end());
+        for (int j = 0; j < chunk.ingredients.size(); j++){
+            chunk.ingredients[j].firstItem += base;
+            chunk.ingredients[j].firstRemoved += base;
+            ingredientEntries.push_back(chunk.ingredients[j]);
+        }
+        for (int j = 0; j < chunk.recipes.size(); j++){
+            chunk.recipes[j].firstItem += base;
+            chunk.recipes[j].firstRemoved += base;
+            recipeEntries.push_back(chunk.recipes[j]);
+        }
+    }
+
+    //Only one line may set the bar information.
+    for (int i = 1; i < bars.size(); i++){
+        //This is checked before the syntax of the line.
+        if (errorLine == bars[i].lineNum) errorLine = INT_MAX;
+        setError(bars[i].lineNum, lineError(bars[i].lineNum, "BAR information already set."));
+    }
+
+    //Resolves the names in dependency order.
+    CatalogIndex ingredientIndex;
+    vector<int> targets(items.size(), -1);
+    vector<int> baseTargets(recipeEntries.size(), -1);
+    vector<int> ingredientOrder;
+    vector<int> recipeOrder;
+    resolveIngredients(ingredientEntries, items, ingredientIndex, targets, ingredientOrder);
+    resolveRecipes(recipeEntries, items, ingredientIndex, targets, baseTargets, recipeOrder);
+
+    if (errorLine != INT_MAX){
+        *msg = error;
+        return false;
+    }
+
+    //Nothing can fail from here on.
+    if (bars.size() > 0){
+        bars[0].name.copyTo(name);
+        funds = bars[0].price;
+        barSet = true;
+    }
+
+    //Creates the ingredients, linking them through the resolved entries.
+    vector<Ingredient*> createdIngredients(ingredientEntries.size(), NULL);
+    for (int i = 0; i < ingredientOrder.size(); i++){
+        const CatalogEntry& entry = ingredientEntries[ingredientOrder[i]];
+        entry.name.copyTo(itemName);
+
+        if (!entry.complex){
+            inventory->addSimpleIngredient(itemName, entry.quantity, entry.price);
+        } else {
+            vector<Ingredient*>* listOfIngredients = new vector<Ingredient*>();
+            gatherIngredients(items, targets, createdIngredients, entry.firstItem, entry.itemCount,
+                              *listOfIngredients);
+            inventory->addComplexIngredient(itemName, entry.price, listOfIngredients);
+        }
+
+        createdIngredients[ingredientOrder[i]] = inventory->getIngredient(inventory->getInventorySize() - 1);
+    }
+
+    //Creates the recipes the same way.
+    vector<Recipe*> createdRecipes(recipeEntries.size(), NULL);
+    for (int i = 0; i < recipeOrder.size(); i++){
+        int current = recipeOrder[i];
+        const CatalogEntry& entry = recipeEntries[current];
+        vector<Ingredient*> recipeIngredients;
+        vector<Ingredient*> removals;
+
+        entry.name.copyTo(itemName);
+        gatherIngredients(items, targets, createdIngredients, entry.firstItem, entry.itemCount,
+                          recipeIngredients);
+
+        Recipe* created;
+        if (!entry.complex){
+            created = new Recipe(itemName, recipeIngredients, entry.price, inventory->getIndex());
+        } else {
+            gatherIngredients(items, targets, createdIngredients, entry.firstRemoved, entry.removedCount,
+                              removals);
+
+            Recipe* baseRecipe;
+            if (baseTargets[current] >= 0){
+                baseRecipe = createdRecipes[baseTargets[current]];
+            } else {
+                entry.base.copyTo(scratch);
+                baseRecipe = recipes->getRecipe(scratch);
+            }
+
+            created = new ComplexRecipe(itemName, recipeIngredients, baseRecipe, removals, entry.price,
+                                        inventory->getIndex());
+        }
+
+        recipes->addRecipe(created);
+        createdRecipes[current] = created;
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Adds an ingredient to the inventory
+ * based on some line of text.
+ * @param line The line to add.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogLoader::addIngredientLine(StringRef line, string* msg){
+    CatalogEntry entry;
+    lineItems.clear();
+
+    if (!parser.parseIngredient(line, entry, lineItems, msg) ||
+        !addIngredient(entry, lineItems, msg)){
+        return false;
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Adds a recipe to the recipe list
+ * based on some line of text.
+ * @param line The line to add.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogLoader::addRecipeLine(StringRef line, string* msg){
+    CatalogEntry entry;
+    lineItems.clear();
+    bool parsed = parser.parseRecipe(line, entry, lineItems, msg);
+
+    //Recipe names must be unique.
+    if (entry.name.length > 0){
+        entry.name.copyTo(itemName);
+        if (recipes->exists(itemName)){
+            *msg = "Recipe already exists.";
+            return false;
+        }
+    }
+
+    if (!parsed || !addRecipe(entry, lineItems, msg)) return false;
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Checks whether the last load set the bar information.
+ * @return Boolean indicating whether it was set.
+ */
+bool CatalogLoader::hasBar(){
+    return barSet;
+}
+
+/**
+ * Gets the bar name from the last load.
+ * @return The bar name.
+ */
+string CatalogLoader::getName(){
+    return name;
+}
+
+/**
+ * Gets the bar funds from the last load.
+ * @return The bar funds.
+ */
+float CatalogLoader::getFunds(){
+    return funds;
+}
+
+/**
+ * Works out what a line is based on the section flags
+ * seen so far. Section flag lines update the flags.
+ * @param line The line to check.
+ * @param barFlag Whether BAR has been seen.
+ * @param ingFlag Whether INGREDIENT has been seen.
+ * @param recipeFlag Whether RECIPE has been seen.
+ * @param msg Set if a section flag is out of order.
+ * @return The kind of line.
+ */
+int CatalogLoader::checkLine(StringRef line, bool* barFlag, bool* ingFlag, bool* recipeFlag, string* msg){
+    if (line.equals(BAR_FLAG)){
+        //Perform sanity check.
+        if (*barFlag) *msg = "BAR command already encountered.";
+
+        *barFlag = true;
+        return FLAG_LINE;
+    } else if (line.equals(ING_FLAG)){
+        //Perform sanity check.
+        if (!*barFlag) *msg = "BAR command comes first.";
+        else if (*ingFlag) *msg = "INGREDIENT command already encountered.";
+
+        *ingFlag = true;
+        return FLAG_LINE;
+    } else if (line.equals(RECIPE_FLAG)){
+        //Perform sanity check.
+        if (!*barFlag) *msg = "BAR command comes first.";
+        else if (!*ingFlag) *msg = "INGREDIENT command comes first.";
+        else if (*recipeFlag) *msg = "RECIPE command already encountered.";
+
+        *recipeFlag = true;
+        return FLAG_LINE;
+    } else if (*recipeFlag){
+        return RECIPE_SECTION;
+    } else if (*ingFlag){
+        return ING_SECTION;
+    } else if (*barFlag){
+        return BAR_SECTION;
+    }
+
+    return NO_SECTION;
+}
+
+/**
+ * Reads the name and funds of the bar.
+ * @param line The line to read.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogLoader::addBarLine(StringRef line, string* msg){
+    //Check for sanity.
+    if (barSet){
+        *msg = "BAR information already set.";
+        return false;
+    }
+
+    CatalogEntry entry;
+    if (!parser.parseBar(line, entry, msg)) return false;
+
+    //Read in the bar name.
+    entry.name.copyTo(name);
+    funds = entry.price;
+    barSet = true;
+    return true;
+}
+
+/**
+ * Creates an ingredient from a parsed entry.
+ * @param entry The parsed ingredient.
+ * @param items The names the entry refers to.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogLoader::addIngredient(const CatalogEntry& entry, const vector<StringRef>& items, string* msg){
+    entry.name.copyTo(itemName);
+
+    //Adds in a simple ingredient.
+    if (!entry.complex){
+        if (!inventory->addSimpleIngredient(itemName, entry.quantity, entry.price)){
+            *msg = "Ingredient already exists.";
+            return false;
+        }
+        return true;
+    }
+
+    if (inventory->exists(itemName)){
+        *msg = "Ingredient already exists.";
+        return false;
+    }
+
+    //Next, finds the sub-ingredients.
+    vector<Ingredient*>* listOfIngredients = new vector<Ingredient*>();
+    if (!findIngredients(items, entry.firstItem, entry.itemCount, *listOfIngredients)){
+        *msg = "Complex ingredient references non-existent ingredient.";
+
+        delete listOfIngredients;
+        return false;
+    }
+
+    //Now, we create the ingredient.
+    inventory->addComplexIngredient(itemName, entry.price, listOfIngredients);
+    return true;
+}
+
+/**
+ * Creates a recipe from a parsed entry. The name
+ * must already have been checked.
+ * @param entry The parsed recipe.
+ * @param items The names the entry refers to.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogLoader::addRecipe(const CatalogEntry& entry, const vector<StringRef>& items, string* msg){
+    vector<Ingredient*> recipeIngredients;
+    vector<Ingredient*> removals;
+    entry.name.copyTo(itemName);
+
+    //Creates a simple recipe.
+    if (!entry.complex){
+        if (!findIngredients(items, entry.firstItem, entry.itemCount, recipeIngredients)){
+            *msg = "Recipe references non-existent ingredient.";
+            return false;
+        }
+
+        recipes->addRecipe(new Recipe(itemName, recipeIngredients, entry.price, inventory->getIndex()));
+        return true;
+    }
+
+    //Next, we get the base recipe.
+    entry.base.copyTo(scratch);
+    Recipe* baseRecipe = recipes->getRecipe(scratch);
+    if (baseRecipe == NULL){
+        *msg = "Base recipe does not exist.";
+        return false;
+    }
+
+    //Finds the additions and then the removals.
+    if (!findIngredients(items, entry.firstItem, entry.itemCount, recipeIngredients) ||
+        !findIngredients(items, entry.firstRemoved, entry.removedCount, removals)){
+        *msg = "Recipe references non-existent ingredient.";
+        return false;
+    }
+
+    //Creates the recipe.
+    recipes->addRecipe(new ComplexRecipe(itemName, recipeIngredients, baseRecipe,
+                                         removals, entry.price, inventory->getIndex()));
+    return true;
+}
+
+/**
+ * Looks up a run of ingredient names.
+ * @param items The names of the ingredients.
+ * @param first The first name to look up.
+ * @param count The number of names to look up.
+ * @param list The list to add the ingredients to.
+ * @return Boolean indicating whether they all exist.
+ */
+bool CatalogLoader::findIngredients(const vector<StringRef>& items, int first, int count,
+                                    vector<Ingredient*>& list){
+    for (int i = first; i < first + count; i++){
+        Ingredient* current = findIngredient(items[i]);
+        if (current == NULL) return false;
+
+        list.push_back(current);
+    }
+
+    return true;
+}
+
+/**
+ * Looks up an ingredient by a token. Reuses the
+ * same string for every lookup.
+ * @param item The name of the ingredient.
+ * @return The ingredient or NULL if it doesn't exist.
+ */
+Ingredient* CatalogLoader::findIngredient(StringRef item){
+    item.copyTo(scratch);
+    return inventory->getIngredient(scratch);
+}
+
+/**
+ * Formats an error for a line of the catalog.
+ * @param lineNum The line the error is on.
+ * @param msg The error.
+ * @return The formatted error.
+ */
+string CatalogLoader::lineError(int lineNum, const string& msg){
+    return "Error on line " + to_string(lineNum) + ": " + msg;
+}
+
+/**
+ * Runs a step of the parallel load with one thread
+ * per chunk. The calling thread takes the first chunk.
+ * @param work The step to run.
+ * @param chunks The chunks of the catalog.
+ */
+void CatalogLoader::runChunks(void (CatalogLoader::*work)(CatalogChunk*), vector<CatalogChunk>& chunks){
+    vector<thread> workers;
+    for (int i = 1; i < chunks.size(); i++){
+        workers.push_back(thread(work, this, &chunks[i]));
+    }
+
+    (this->*work)(&chunks[0]);
+    for (int i = 0; i < workers.size(); i++){
+        workers.at(i).join();
+    }
+}
+
+/**
+ * Splits a chunk into lines. Blank lines and comments
+ * are counted but not kept.
+ * @param chunk The chunk to split.
+ */
+void CatalogLoader::scanChunk(CatalogChunk* chunk){
+    chunk->lineCount = 0;
+
+    const char* current = chunk->start;
+    while (current < chunk->end){
+        //Cuts the next line out of the buffer.
+        const char* newline = (const char*) memchr(current, '\n', chunk->end - current);
+        const char* lineEnd = (newline == NULL) ? chunk->end : newline;
+        StringRef line(current, lineEnd - current);
+        current = (newline == NULL) ? chunk->end : newline + 1;
+        chunk->lineCount++;
+
+        if (line.endsWith('\r')) line.length--;
+
+        //Checks for blank characters.
+        if (line.startsWith("//") || line.length == 0)
+            continue;
+
+        chunk->lines.push_back(line);
+        chunk->lineNums.push_back(chunk->lineCount);
+    }
+
+    chunk->sections.assign(chunk->lines.size(), NO_SECTION);
+}
+
+/**
+ * Works out the section of every line in file order and
+ * numbers the lines. Stops at the first out of order
+ * section flag, leaving the rest of the lines unparsed.
+ * @param chunks The chunks of the catalog.
+ */
+void CatalogLoader::assignSections(vector<CatalogChunk>& chunks){
+    bool barFlag = false;
+    bool ingFlag = false;
+    bool recipeFlag = false;
+
+    int firstLine = 0;
+    for (int i = 0; i < chunks.size(); i++){
+        chunks[i].firstLine = firstLine;
+        firstLine += chunks[i].lineCount;
+    }
+
+    for (int i = 0; i < chunks.size(); i++){
+        CatalogChunk& chunk = chunks[i];
+        for (int j = 0; j < chunk.lines.size(); j++){
+            int lineNum = chunk.firstLine + chunk.lineNums[j];
+
+            string flagError;
+            int kind = checkLine(chunk.lines[j], &barFlag, &ingFlag, &recipeFlag, &flagError);
+            if (kind == NO_SECTION){
+                setError(lineNum, "Unknown error encountered at line " + to_string(lineNum) + ".");
+                return;
+            } else if (!flagError.empty()){
+                setError(lineNum, lineError(lineNum, flagError));
+                return;
+            }
+
+            chunk.sections[j] = kind;
+            chunk.lineNums[j] = lineNum;
+        }
+    }
+}
+
+/**
+ * Checks the syntax of every line in a chunk and breaks
+ * them into entries. Stops at the first bad line.
+ * @param chunk The chunk to parse.
+ */
+void CatalogLoader::parseChunk(CatalogChunk* chunk){
+    CatalogParser lineParser;
+
+    for (int i = 0; i < chunk->lines.size(); i++){
+        int section = chunk->sections[i];
+        if (section == NO_SECTION || section == FLAG_LINE) continue;
+
+        CatalogEntry entry;
+        entry.lineNum = chunk->lineNums[i];
+        string lineMsg;
+        bool parsed;
+
+        if (section == BAR_SECTION){
+            parsed = lineParser.parseBar(chunk->lines[i], entry, &lineMsg);
+            chunk->bars.push_back(entry);
+        } else if (section == ING_SECTION){
+            parsed = lineParser.parseIngredient(chunk->lines[i], entry, chunk->items, &lineMsg);
+            if (parsed) chunk->ingredients.push_back(entry);
+        } else {
+            //Bad recipes are kept so their names are still checked.
+            parsed = lineParser.parseRecipe(chunk->lines[i], entry, chunk->items, &lineMsg);
+            if (parsed || entry.name.length > 0) chunk->recipes.push_back(entry);
+        }
+
+        if (!parsed){
+            chunk->errorLine = entry.lineNum;
+            chunk->error = lineError(entry.lineNum, lineMsg);
+            return;
+        }
+    }
+}
+
+/**
+ * Checks the ingredient names and orders the ingredients
+ * so every ingredient comes after the ones it is made of.
+ * @param entries The parsed ingredients in file order.
+ * @param items The names the entries refer to.
+ * @param index Filled with the entry of every ingredient name.
+ * @param targets Filled with the entry of every ingredient name used.
+ * @param order Filled with the order to create the entries in.
+ */
+void CatalogLoader::resolveIngredients(const vector<CatalogEntry>& entries, const vector<StringRef>& items,
+                                       CatalogIndex& index, vector<int>& targets, vector<int>& order){
+    vector<pair<int, int> > edges;
+    bool checkInventory = inventory->getInventorySize() > 0;
+    index.reserve(entries.size());
+
+    //Ingredient names must be unique.
+    for (int i = 0; i < entries.size(); i++){
+        if (checkInventory) entries[i].name.copyTo(scratch);
+        if (index.count(entries[i].name) > 0 || (checkInventory && inventory->exists(scratch))){
+            setError(entries[i].lineNum, lineError(entries[i].lineNum, "Ingredient already exists."));
+            continue;
+        }
+
+        index[entries[i].name] = i;
+    }
+
+    //Links complex ingredients to the ingredients they use.
+    for (int i = 0; i < entries.size(); i++){
+        const CatalogEntry& entry = entries[i];
+        for (int j = entry.firstItem; j < entry.firstItem + entry.itemCount; j++){
+            CatalogIndex::const_iterator it = index.find(items[j]);
+            if (it != index.end()){
+                edges.push_back(make_pair(it->second, i));
+                targets[j] = it->second;
+            } else if (!checkInventory || findIngredient(items[j]) == NULL){
+                setError(entry.lineNum, lineError(entry.lineNum,
+                                                  "Complex ingredient references non-existent ingredient."));
+                break;
+            }
+        }
+    }
+
+    sortDependencies(entries, edges, order, "Complex ingredient has a circular reference.");
+}
+
+/**
+ * Checks the recipe names and orders the recipes so
+ * every complex recipe comes after its base recipe.
+ * @param entries The parsed recipes in file order.
+ * @param items The names the entries refer to.
+ * @param ingredientIndex The entry of every ingredient name.
+ * @param targets Filled with the entry of every ingredient name used.
+ * @param baseTargets Filled with the entry of every base recipe.
+ * @param order Filled with the order to create the entries in.
+ */
+void CatalogLoader::resolveRecipes(const vector<CatalogEntry>& entries, const vector<StringRef>& items,
+                                   const CatalogIndex& ingredientIndex, vector<int>& targets,
+                                   vector<int>& baseTargets, vector<int>& order){
+    vector<pair<int, int> > edges;
+    bool checkInventory = inventory->getInventorySize() > 0;
+    bool checkRecipes = recipes->getSize() > 0;
+    CatalogIndex index;
+    index.reserve(entries.size());
+
+    //Recipe names must be unique.
+    for (int i = 0; i < entries.size(); i++){
+        if (checkRecipes) entries[i].name.copyTo(scratch);
+        if (index.count(entries[i].name) > 0 || (checkRecipes && recipes->exists(scratch))){
+            //This is checked before the syntax of the line.
+            if (errorLine == entries[i].lineNum) errorLine = INT_MAX;
+            setError(entries[i].lineNum, lineError(entries[i].lineNum, "Recipe already exists."));
+            continue;
+        }
+
+        if (entries[i].valid) index[entries[i].name] = i;
+    }
+
+    //Links complex recipes to their base and checks every ingredient.
+    for (int i = 0; i < entries.size(); i++){
+        const CatalogEntry& entry = entries[i];
+        if (!entry.valid) continue;
+
+        if (entry.complex){
+            CatalogIndex::const_iterator it = index.find(entry.base);
+            if (checkRecipes) entry.base.copyTo(scratch);
+
+            if (it != index.end()){
+                edges.push_back(make_pair(it->second, i));
+                baseTargets[i] = it->second;
+            } else if (!checkRecipes || !recipes->exists(scratch)){
+                setError(entry.lineNum, lineError(entry.lineNum, "Base recipe does not exist."));
+                continue;
+            }
+        }
+
+        //The removals directly follow the additions.
+        for (int j = entry.firstItem; j < entry.firstRemoved + entry.removedCount; j++){
+            CatalogIndex::const_iterator it = ingredientIndex.find(items[j]);
+            if (it != ingredientIndex.end()){
+                targets[j] = it->second;
+            } else if (!checkInventory || findIngredient(items[j]) == NULL){
+                setError(entry.lineNum, lineError(entry.lineNum, "Recipe references non-existent ingredient."));
+                break;
+            }
+        }
+    }
+
+    sortDependencies(entries, edges, order, "Complex recipe has a circular base recipe.");
+}
+
+/**
+ * Orders entries so every entry comes after the ones it
+ * depends on. Ties are broken by file order, so a file
+ * without forward references keeps its order.
+ * @param entries The entries to order.
+ * @param edges Pairs of an entry and an entry that depends on it.
+ * @param order Filled with the order to create the entries in.
+ * @param cycle The error if some entries depend on each other.
+ */
+void CatalogLoader::sortDependencies(const vector<CatalogEntry>& entries, const vector<pair<int, int> >& edges,
+                                     vector<int>& order, const string& cycle){
+    int numEntries = entries.size();
+    vector<int> waiting(numEntries, 0);
+    vector<int> offsets(numEntries + 1, 0);
+    vector<int> dependents(edges.size());
+
+    //Groups the dependents of every entry.
+    for (int i = 0; i < edges.size(); i++){
+        waiting[edges[i].second]++;
+        offsets[edges[i].first + 1]++;
+    }
+    for (int i = 0; i < numEntries; i++){
+        offsets[i + 1] += offsets[i];
+    }
+
+    vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (int i = 0; i < edges.size(); i++){
+        dependents[next[edges[i].first]++] = edges[i].second;
+    }
+
+    //Takes whichever ready entry comes first in the file.
+    priority_queue<int, vector<int>, greater<int> > ready;
+    for (int i = 0; i < numEntries; i++){
+        if (waiting[i] == 0) ready.push(i);
+    }
+
+    order.clear();
+    order.reserve(numEntries);
+    while (!ready.empty()){
+        int current = ready.top();
+        ready.pop();
+        order.push_back(current);
+
+        for (int i = offsets[current]; i < offsets[current + 1]; i++){
+            if (--waiting[dependents[i]] == 0) ready.push(dependents[i]);
+        }
+    }
+
+    //Anything left over is part of a cycle.
+    for (int i = 0; i < numEntries && order.size() < numEntries; i++){
+        if (waiting[i] > 0){
+            setError(entries[i].lineNum, lineError(entries[i].lineNum, cycle));
+            break;
+        }
+    }
+}
+
+/**
+ * Gathers a run of resolved ingredient names. Names that
+ * resolved to an entry use the ingredient created for it,
+ * the rest were already in the inventory.
+ * @param items The names of the ingredients.
+ * @param targets The entry every name resolved to or -1.
+ * @param created The ingredient created for every entry.
+ * @param first The first name to gather.
+ * @param count The number of names to gather.
+ * @param list The list to add the ingredients to.
+ */
+void CatalogLoader::gatherIngredients(const vector<StringRef>& items, const vector<int>& targets,
+                                      const vector<Ingredient*>& created, int first, int count,
+                                      vector<Ingredient*>& list){
+    for (int i = first; i < first + count; i++){
+        list.push_back(targets[i] >= 0 ? created[targets[i]] : findIngredient(items[i]));
+    }
+}
+
+/**
+ * Records an error found by the parallel load. Only the
+ * error on the earliest line is kept.
+ * @param lineNum The line the error is on.
+ * @param msg The full error message.
+ */
+void CatalogLoader::setError(int lineNum, const string& msg){
+    if (lineNum >= errorLine) return;
+
+    errorLine = lineNum;
+    error = msg;
+}
@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CatalogLoader.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Parses the BAR, INGREDIENT and RECIPE sections of a catalog straight
+// out of a memory-mapped buffer. Tokens are views into the buffer so
+// only the final ingredients and recipes are allocated.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_CATALOGLOADER_H
+#define SANDWICH_BAR_CATALOGLOADER_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CatalogParser.h"
+#include "StringRef.h"
+#include "../Capital/RecipeCatalog.h"
+#include "../Capital/PriceUpdate.h"
+#include "../FoodItems/Inventory.h"
+
+struct CatalogChunk {
+    const char* start;
+    const char* end;
+    int firstLine;
+    int lineCount;
+    std::vector<StringRef> lines;
+    std::vector<int> lineNums;
+    std::vector<int> sections;
+    std::vector<CatalogEntry> bars;
+    std::vector<CatalogEntry> ingredients;
+    std::vector<CatalogEntry> recipes;
+    std::vector<StringRef> items;
+    int errorLine;
+    std::string error;
+};
+
+typedef std::unordered_map<StringRef, int, StringRefHash> CatalogIndex;
+
+class CatalogLoader {
+public:
+    /** Constructor/Destructor */
+    CatalogLoader(Inventory* inventory, RecipeCatalog* recipes);
+    ~CatalogLoader();
+
+    /** Load Methods */
+    bool load(const char* data, size_t size, std::string* msg);
+    bool loadParallel(const char* data, size_t size, int numThreads, std::string* msg);
+    bool addIngredientLine(StringRef line, std::string* msg);
+    bool addRecipeLine(StringRef line, std::string* msg);
+    bool loadPrices(const char* data, size_t size, PriceUpdate& update, std::string* msg);
+
+    /** Bar Methods */
+    bool hasBar();
+    std::string getName();
+    float getFunds();
+
+private:
+    /** Private Variables */
+    Inventory* inventory;
+    RecipeCatalog* recipes;
+    CatalogParser parser;
+    bool barSet;
+    std::string name;
+    float funds;
+    std::vector<StringRef> lineItems;
+    std::string itemName;
+    std::string scratch;
+    int errorLine;
+    std::string error;
+
+    /** Helper Methods */
+    int checkLine(StringRef line, bool* barFlag, bool* ingFlag, bool* recipeFlag, std::string* msg);
+    bool addBarLine(StringRef line, std::string* msg);
+    bool addIngredient(const CatalogEntry& entry, const std::vector<StringRef>& items, std::string* msg);
+    bool addRecipe(const CatalogEntry& entry, const std::vector<StringRef>& items, std::string* msg);
+    bool findIngredients(const std::vector<StringRef>& items, int first, int count,
+                         std::vector<Ingredient*>& list);
+    Ingredient* findIngredient(StringRef item);
+    static std::string lineError(int lineNum, const std::string& msg);
+
+    /** Parallel Helper Methods */
+    void runChunks(void (CatalogLoader::*work)(CatalogChunk*), std::vector<CatalogChunk>& chunks);
+    void scanChunk(CatalogChunk* chunk);
+    void parseChunk(CatalogChunk* chunk);
+    void assignSections(std::vector<CatalogChunk>& chunks);
+    void resolveIngredients(const std::vector<CatalogEntry>& entries, const std::vector<StringRef>& items,
+                            CatalogIndex& index, std::vector<int>& targets, std::vector<int>& order);
+    void resolveRecipes(const std::vector<CatalogEntry>& entries, const std::vector<StringRef>& items,
+                        const CatalogIndex& ingredientIndex, std::vector<int>& targets,
+                        std::vector<int>& baseTargets, std::vector<int>& order);
+    void sortDependencies(const std::vector<CatalogEntry>& entries,
+                          const std::vector<std::pair<int, int> >& edges,
+                          std::vector<int>& order, const std::string& cycle);
+    void gatherIngredients(const std::vector<StringRef>& items, const std::vector<int>& targets,
+                           const std::vector<Ingredient*>& created, int first, int count,
+                           std::vector<Ingredient*>& list);
+    void setError(int lineNum, const std::string& msg);
+
+    /** Load Flags */
+    const std::string BAR_FLAG = "BAR";
+    const std::string ING_FLAG = "INGREDIENT";
+    const std::string RECIPE_FLAG = "RECIPE";
+
+    /** Line Kinds */
+    static const int NO_SECTION = 0;
+    static const int FLAG_LINE = 1;
+    static const int BAR_SECTION = 2;
+    static const int ING_SECTION = 3;
+    static const int RECIPE_SECTION = 4;
+};
+
+
+#endif //SANDWICH_BAR_CATALOGLOADER_H
@@ -0,0 +1,278 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CatalogParser.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Checks the syntax of single catalog lines and breaks them into
+// entries without touching the bar. Each parser keeps its own scratch
+// space so several threads can parse lines at once.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "CatalogParser.h"
+
+using namespace std;
+
+/**
+ * Creates a parser with empty scratch space.
+ */
+CatalogParser::CatalogParser(){ }
+
+/**
+ * Default destructor.
+ */
+CatalogParser::~CatalogParser(){ }
+
+/**
+ * Parses the line holding the bar name and funds.
+ * @param line The line to parse.
+ * @param entry The entry to fill in.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogParser::parseBar(StringRef line, CatalogEntry& entry, string* msg){
+    entry.valid = tokenize(line) == 2 && parseFloat(tokens[1], &entry.price);
+    if (!entry.valid){
+        *msg = "Invalid BAR command.";
+        return false;
+    }
+
+    entry.name = tokens[0];
+    return true;
+}
+
+/**
+ * Parses an ingredient line. The names the ingredient
+ * is made of are added to the item list.
+ * @param line The line to parse.
+ * @param entry The entry to fill in.
+ * @param items The list to add the ingredient names to.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogParser::parseIngredient(StringRef line, CatalogEntry& entry,
+                                    vector<StringRef>& items, string* msg){
+    int count = tokenize(line);
+    entry.valid = false;
+    entry.firstItem = items.size();
+    entry.itemCount = 0;
+    entry.firstRemoved = items.size();
+    entry.removedCount = 0;
+
+    if (count == 0){
+        *msg = "Invalid INGREDIENT command.";
+        return false;
+    }
+
+    //Check type of ingredient.
+    if (tokens[0].equals(SIMPLE)){
+        //Perform sanity check.
+        if (count != 4 || !parseFloat(tokens[2], &entry.price) || !parseInt(tokens[3], &entry.quantity)){
+            *msg = "Invalid INGREDIENT command.";
+            return false;
+        }
+
+        entry.complex = false;
+    } else if (tokens[0].equals(COMPLEX)){
+        //Perform sanity check.
+        if (count < 4 || isEmptyList(tokens[3]) || !parseFloat(tokens[2], &entry.price)){
+            *msg = "Invalid INGREDIENT command.";
+            return false;
+        }
+
+        int index = 3;
+        readList(index, true, items, &entry.itemCount);
+        entry.complex = true;
+        entry.quantity = 0;
+    } else {
+        *msg = "Unknown ingredient command.";
+        return false;
+    }
+
+    entry.name = tokens[1];
+    entry.valid = true;
+    return true;
+}
+
+/**
+ * Parses a recipe line. The ingredient names are added
+ * to the item list, followed by the removals. The name
+ * is filled in even when the line is invalid.
+ * @param line The line to parse.
+ * @param entry The entry to fill in.
+ * @param items The list to add the ingredient names to.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogParser::parseRecipe(StringRef line, CatalogEntry& entry,
+                                vector<StringRef>& items, string* msg){
+    int count = tokenize(line);
+    entry.valid = false;
+    entry.name = (count > 1) ? tokens[1] : StringRef();
+    entry.firstItem = items.size();
+    entry.itemCount = 0;
+    entry.firstRemoved = items.size();
+    entry.removedCount = 0;
+
+    if (count == 0){
+        *msg = "Invalid RECIPE command.";
+        return false;
+    }
+
+    //Check what type of recipe we have.
+    if (tokens[0].equals(SIMPLE)){
+        //Perform sanity check.
+        if (count < 4 || isEmptyList(tokens[3]) || !parseFloat(tokens[2], &entry.price)){
+            *msg = "Invalid RECIPE command.";
+            return false;
+        }
+
+        int index = 3;
+        readList(index, true, items, &entry.itemCount);
+        entry.firstRemoved = items.size();
+        entry.complex = false;
+    } else if (tokens[0].equals(COMPLEX)){
+        //Perform sanity check.
+        if (count < 6 || (isEmptyList(tokens[4]) && isEmptyList(tokens[5]))
+            || !parseFloat(tokens[3], &entry.price)){
+            *msg = "Invalid RECIPE command.";
+            return false;
+        }
+
+        //Reads the additions and then the removals.
+        int index = 4;
+        bool added = readList(index, false, items, &entry.itemCount);
+        entry.firstRemoved = items.size();
+        if (!added || !readList(index, false, items, &entry.removedCount)){
+            *msg = "Invalid RECIPE command.";
+            return false;
+        }
+
+        entry.base = tokens[2];
+        entry.complex = true;
+    } else {
+        *msg = "Unknown RECIPE command.";
+        return false;
+    }
+
+    entry.valid = true;
+    return true;
+}
+
+/**
+ * Parses a line of a price file holding an
+ * ingredient name and its new cost.
+ * @param line The line to parse.
+ * @param entry The entry to fill in.
+ * @param msg A string that will have an error message returned.
+ * @return A boolean indicating success.
+ */
+bool CatalogParser::parsePrice(StringRef line, CatalogEntry& entry, string* msg){
+    entry.valid = tokenize(line) == 2 && parseFloat(tokens[1], &entry.price) && entry.price >= 0;
+    if (!entry.valid){
+        *msg = "Invalid price.";
+        return false;
+    }
+
+    entry.name = tokens[0];
+    return true;
+}
+
+/**
+ * Splits a line on commas into views of the line.
+ * Empty tokens are skipped. The tokens are kept
+ * until the next line is split.
+ * @param line The line to split.
+ * @return The number of tokens.
+ */
+int CatalogParser::tokenize(StringRef line){
+    tokens.clear();
+
+    size_t start = 0;
+    for (size_t i = 0; i <= line.length; i++){
+        if (i < line.length && line.data[i] != ',') continue;
+
+        if (i > start) tokens.push_back(StringRef(line.data + start, i - start));
+        start = i + 1;
+    }
+
+    return tokens.size();
+}
+
+/**
+ * Reads a braced list of names starting at a token.
+ * The list either runs to the end of the line or stops
+ * at the token ending in a closing brace.
+ * @param index The first token. Moved past the list.
+ * @param toEnd Whether the list runs to the end of the line.
+ * @param items The list to add the names to.
+ * @param count Set to the number of names read.
+ * @return A boolean indicating whether the list was closed.
+ */
+bool CatalogParser::readList(int& index, bool toEnd, vector<StringRef>& items, int* count){
+    *count = 0;
+
+    //Checks whether the list is empty.
+    if (index < tokens.size() && isEmptyList(tokens[index])){
+        index++;
+        return true;
+    }
+
+    int first = index;
+    while (index < tokens.size()){
+        StringRef item = tokens[index];
+        bool last = toEnd ? index == tokens.size() - 1 : item.endsWith('}');
+
+        //Removes the curly braces.
+        if (index == first && item.startsWith("{")){
+            item.data++;
+            item.length--;
+        }
+        if (last && item.endsWith('}')) item.length--;
+
+        items.push_back(item);
+        (*count)++;
+        index++;
+        if (last) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Parses a decimal number out of a token.
+ * @param token The token to parse.
+ * @param value Where the number is stored.
+ * @return Boolean indicating whether it was a number.
+ */
+bool CatalogParser::parseFloat(StringRef token, float* value){
+    token.copyTo(scratch);
+
+    char* end;
+    *value = strtof(scratch.c_str(), &end);
+    return end != scratch.c_str();
+}
+
+/**
+ * Parses a whole number out of a token.
+ * @param token The token to parse.
+ * @param value Where the number is stored.
+ * @return Boolean indicating whether it was a number.
+ */
+bool CatalogParser::parseInt(StringRef token, int* value){
+    token.copyTo(scratch);
+
+    char* end;
+    *value = (int) strtol(scratch.c_str(), &end, 10);
+    return end != scratch.c_str();
+}
+
+/**
+ * Checks whether a token is an empty list.
+ * @param token The token to check.
+ * @return Boolean indicating whether it is empty.
+ */
+bool CatalogParser::isEmptyList(StringRef token){
+    return token.equals("{}") || token.equals("{ }");
+}
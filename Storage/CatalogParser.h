@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CatalogParser.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Checks the syntax of single catalog lines and breaks them into
+// entries without touching the bar. Each parser keeps its own scratch
+// space so several threads can parse lines at once.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_CATALOGPARSER_H
+#define SANDWICH_BAR_CATALOGPARSER_H
+
+#include <string>
+#include <vector>
+#include "StringRef.h"
+
+struct CatalogEntry {
+    int lineNum;
+    bool valid;
+    bool complex;
+    StringRef name;
+    StringRef base;
+    float price;
+    int quantity;
+    int firstItem;
+    int itemCount;
+    int firstRemoved;
+    int removedCount;
+};
+
+class CatalogParser {
+public:
+    /** Constructor/Destructor */
+    CatalogParser();
+    ~CatalogParser();
+
+    /** Parse Methods */
+    bool parseBar(StringRef line, CatalogEntry& entry, std::string* msg);
+    bool parseIngredient(StringRef line, CatalogEntry& entry,
+                         std::vector<StringRef>& items, std::string* msg);
+    bool parseRecipe(StringRef line, CatalogEntry& entry,
+                     std::vector<StringRef>& items, std::string* msg);
+    bool parsePrice(StringRef line, CatalogEntry& entry, std::string* msg);
+
+private:
+    /** Private Variables */
+    std::vector<StringRef> tokens;
+    std::string scratch;
+
+    /** Helper Methods */
+    int tokenize(StringRef line);
+    bool readList(int& index, bool toEnd, std::vector<StringRef>& items, int* count);
+    bool parseFloat(StringRef token, float* value);
+    bool parseInt(StringRef token, int* value);
+    static bool isEmptyList(StringRef token);
+
+    /** Line Flags */
+    const std::string SIMPLE = "simple";
+    const std::string COMPLEX = "complex";
+};
+
+
+#endif //SANDWICH_BAR_CATALOGPARSER_H
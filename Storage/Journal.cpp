@@ -0,0 +1,593 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Journal.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Append-only journal of everything that changes the bar since the last
+// snapshot. Records are compact binary and checksummed, written in groups
+// with a configurable number of records between each fsync. The header
+// names the snapshot generation the journal replays onto.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Journal.h"
+
+using namespace std;
+
+const uint32_t Journal::ORDER_RECORD;
+const uint32_t Journal::RESTOCK_RECORD;
+const uint32_t Journal::INGREDIENT_RECORD;
+const uint32_t Journal::RECIPE_RECORD;
+const uint32_t Journal::CATALOG_RECORD;
+const uint32_t Journal::PRICE_RECORD;
+
+/**
+ * Creates a journal that isn't open. Every record
+ * is synced by default.
+ */
+Journal::Journal(){
+    generation = 0;
+    descriptor = -1;
+    syncInterval = 1;
+    unsynced = 0;
+    healthy = false;
+    recordStart = 0;
+    readOffset = 0;
+    validEnd = 0;
+    recovered = 0;
+    truncated = false;
+    nextDescriptor = -1;
+    nextGeneration = 0;
+}
+
+/**
+ * Closes the journal if it is still open.
+ */
+Journal::~Journal(){
+    close();
+}
+
+/**
+ * Opens a journal, creating it if it doesn't exist. The
+ * records left by a previous run are checked and can be
+ * read back with next. A record cut off by a crash is
+ * dropped from the end of the file. A journal started for
+ * another snapshot generation is refused.
+ * @param filename The journal file.
+ * @param generation The generation of the snapshot the bar holds.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Journal::open(const string& filename, uint64_t generation, string* msg){
+    close();
+    this->filename = filename;
+    this->generation = generation;
+    recovered = 0;
+    truncated = false;
+    validEnd = 0;
+    finishCrashedRotation();
+
+    //Reads back whatever a previous run left.
+    if (existing.open(filename) && !scan(msg)){
+        existing.close();
+        return false;
+    }
+
+    descriptor = ::open(filename.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (descriptor == -1){
+        existing.close();
+        *msg = "Journal could not be opened.";
+        return false;
+    }
+
+    //Starts a new journal or cuts off a torn record.
+    healthy = true;
+    if (validEnd == 0){
+        healthy = ftruncate(descriptor, 0) == 0 && writeHeader(descriptor, generation) &&
+                  MappedFile::syncDirectory(filename);
+    } else if (truncated){
+        healthy = ftruncate(descriptor, validEnd) == 0 && fsync(descriptor) == 0;
+    }
+    lseek(descriptor, 0, SEEK_END);
+    readOffset = sizeof(JournalHeader);
+
+    if (!healthy){
+        close();
+        *msg = "Journal could not be written.";
+        return false;
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Flushes anything buffered and closes the journal.
+ * A rotation that wasn't finished is dropped.
+ */
+void Journal::close(){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor != -1){
+        writeBuffer(syncInterval > 0 && unsynced > 0);
+        ::close(descriptor);
+    }
+    discardRotation();
+
+    existing.close();
+    descriptor = -1;
+    healthy = false;
+}
+
+/**
+ * Checks whether the journal is open.
+ * @return Boolean indicating whether it is open.
+ */
+bool Journal::isOpen(){
+    return descriptor != -1;
+}
+
+/**
+ * Gets the snapshot generation the journal replays onto.
+ * @return The snapshot generation.
+ */
+uint64_t Journal::getGeneration(){
+    return generation;
+}
+
+/**
+ * Starts an empty journal for the next snapshot beside
+ * this one. It is synced before the snapshot is written,
+ * so once the snapshot lands a crash can always finish
+ * the rotation when the journal is opened again.
+ * @param generation The generation of the next snapshot.
+ * @return Boolean indicating success.
+ */
+bool Journal::beginRotation(uint64_t generation){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor == -1) return false;
+    discardRotation();
+
+    string nextName = filename + ".next";
+    nextDescriptor = ::open(nextName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (nextDescriptor == -1) return false;
+
+    if (!writeHeader(nextDescriptor, generation) || !MappedFile::syncDirectory(nextName)){
+        discardRotation();
+        return false;
+    }
+
+    nextGeneration = generation;
+    return true;
+}
+
+/**
+ * Moves the new journal over this one once its snapshot
+ * has been saved. Records still buffered are dropped
+ * since the snapshot holds them.
+ * @return Boolean indicating success.
+ */
+bool Journal::finishRotation(){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor == -1 || nextDescriptor == -1) return false;
+
+    string nextName = filename + ".next";
+    if (rename(nextName.c_str(), filename.c_str()) != 0 || !MappedFile::syncDirectory(filename)){
+        healthy = false;
+        return false;
+    }
+
+    existing.close();
+    buffer.clear();
+    unsynced = 0;
+
+    ::close(descriptor);
+    descriptor = nextDescriptor;
+    generation = nextGeneration;
+    nextDescriptor = -1;
+
+    lseek(descriptor, 0, SEEK_END);
+    healthy = true;
+    return true;
+}
+
+/**
+ * Drops the new journal when its snapshot could not
+ * be saved. The current journal carries on.
+ */
+void Journal::cancelRotation(){
+    lock_guard<mutex> guard(journalLock);
+    discardRotation();
+}
+
+/**
+ * Reads the next record left by a previous run. The
+ * entry is only valid until the next call.
+ * @param entry Gets the record.
+ * @return Boolean indicating whether there was a record.
+ */
+bool Journal::next(JournalEntry& entry){
+    if (existing.getData() == NULL || readOffset >= validEnd){
+        existing.close();
+        return false;
+    }
+
+    JournalRecord record;
+    memcpy(&record, existing.getData() + readOffset, sizeof(record));
+    entry.type = record.type;
+    entry.data = existing.getData() + readOffset + sizeof(record);
+    entry.size = record.size;
+
+    readOffset += sizeof(record) + record.size;
+    return true;
+}
+
+/**
+ * Gets the number of records left by a previous run.
+ * @return The number of records.
+ */
+int Journal::getRecovered(){
+    return recovered;
+}
+
+/**
+ * Checks whether a torn record was cut off the end.
+ * @return Boolean indicating whether the journal was truncated.
+ */
+bool Journal::wasTruncated(){
+    return truncated;
+}
+
+/**
+ * Reads an order or restock record.
+ * @param entry The record to read.
+ * @param amount Gets the revenue or cost.
+ * @param items Gets the stock that was taken or bought.
+ * @return Boolean indicating whether the record was valid.
+ */
+bool Journal::readItems(const JournalEntry& entry, float& amount, vector<BillItem>& items){
+    uint32_t count;
+    if (entry.size < sizeof(amount) + sizeof(count)) return false;
+    memcpy(&amount, entry.data, sizeof(amount));
+    memcpy(&count, entry.data + sizeof(amount), sizeof(count));
+
+    size_t itemSize = entry.size - sizeof(amount) - sizeof(count);
+    if (count > itemSize / sizeof(BillItem) || count * sizeof(BillItem) != itemSize) return false;
+
+    items.resize(count);
+    if (count > 0) memcpy(items.data(), entry.data + sizeof(amount) + sizeof(count), itemSize);
+    return true;
+}
+
+/**
+ * Reads a catalog record.
+ * @param entry The record to read.
+ * @param parallel Gets whether the catalog was loaded in parallel.
+ * @param text Gets the catalog text.
+ * @param size Gets the size of the text.
+ * @return Boolean indicating whether the record was valid.
+ */
+bool Journal::readCatalog(const JournalEntry& entry, bool& parallel, const char*& text, size_t& size){
+    uint32_t flag;
+    if (entry.size < sizeof(flag)) return false;
+    memcpy(&flag, entry.data, sizeof(flag));
+
+    parallel = flag != 0;
+    text = entry.data + sizeof(flag);
+    size = entry.size - sizeof(flag);
+    return true;
+}
+
+/**
+ * Logs a committed order.
+ * @param bill The compacted bill of the order.
+ * @param revenue The revenue of the order.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::logOrder(const BillOfMaterials& bill, float revenue){
+    lock_guard<mutex> guard(journalLock);
+    return logItems(ORDER_RECORD, revenue, bill.getItems());
+}
+
+/**
+ * Logs a restock that was paid for.
+ * @param purchases The stock that was bought.
+ * @param cost The cost of the restock.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::logRestock(const vector<RestockItem>& purchases, float cost){
+    lock_guard<mutex> guard(journalLock);
+
+    restockItems.resize(purchases.size());
+    for (int i = 0; i < purchases.size(); i++){
+        restockItems[i].slot = purchases[i].slot;
+        restockItems[i].count = purchases[i].amount;
+    }
+
+    return logItems(RESTOCK_RECORD, cost, restockItems);
+}
+
+/**
+ * Logs a catalog line or a price file.
+ * @param type The type of record.
+ * @param text The text that was applied.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::logText(uint32_t type, const string& text){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor == -1) return false;
+
+    beginRecord(type);
+    addBytes(text.data(), text.size());
+    return endRecord();
+}
+
+/**
+ * Logs a catalog file that was loaded.
+ * @param data The catalog text.
+ * @param size The size of the text.
+ * @param parallel Whether it was loaded in parallel.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::logCatalog(const char* data, size_t size, bool parallel){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor == -1) return false;
+
+    uint32_t flag = parallel ? 1 : 0;
+    beginRecord(CATALOG_RECORD);
+    addBytes(&flag, sizeof(flag));
+    addBytes(data, size);
+    return endRecord();
+}
+
+/**
+ * Sets how many records are grouped into each fsync.
+ * Records in a group that hasn't been synced can be lost
+ * in a crash.
+ * @param records The records per fsync or 0 to never fsync.
+ */
+void Journal::setSyncInterval(int records){
+    lock_guard<mutex> guard(journalLock);
+    syncInterval = (records < 0 ? 0 : records);
+}
+
+/**
+ * Writes out every buffered record and syncs them
+ * unless the journal never syncs.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::flush(){
+    lock_guard<mutex> guard(journalLock);
+    if (descriptor == -1) return false;
+
+    return writeBuffer(syncInterval > 0 && unsynced > 0);
+}
+
+/**
+ * Checks the records left by a previous run and finds
+ * where the last whole record ends.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating whether the file is a journal for the bar.
+ */
+bool Journal::scan(string* msg){
+    const char* data = existing.getData();
+    size_t size = existing.getSize();
+
+    //A crash while creating the journal leaves a partial header.
+    if (size < sizeof(JournalHeader)){
+        truncated = size > 0;
+        if (size == 0 || memcmp(data, "SBARJRNL", size < 8 ? size : 8) == 0) return true;
+
+        *msg = "Not a sandwich bar journal.";
+        return false;
+    }
+
+    JournalHeader header;
+    if (!readHeader(data, size, header)){
+        *msg = "Not a sandwich bar journal.";
+        return false;
+    } else if (header.generation != generation){
+        *msg = "Journal is for snapshot generation " + to_string(header.generation) +
+               " but the bar is at generation " + to_string(generation) + ".";
+        return false;
+    }
+
+    //Stops at the first record that is cut off or corrupt.
+    size_t offset = sizeof(header);
+    while (size - offset >= sizeof(JournalRecord)){
+        JournalRecord record;
+        memcpy(&record, data + offset, sizeof(record));
+
+        const char* payload = data + offset + sizeof(record);
+        if (record.size > size - offset - sizeof(record)) break;
+        if (checksum(record.type, payload, record.size) != record.checksum) break;
+
+        offset += sizeof(record) + record.size;
+        recovered++;
+    }
+
+    validEnd = offset;
+    truncated = validEnd < size;
+    return true;
+}
+
+/**
+ * Finishes a rotation cut off by a crash. A new journal
+ * for the bar's generation means its snapshot was saved,
+ * so it replaces the old journal. Any other one belongs
+ * to a snapshot that never landed and is removed.
+ */
+void Journal::finishCrashedRotation(){
+    string nextName = filename + ".next";
+    MappedFile pending;
+    if (!pending.open(nextName)) return;
+
+    JournalHeader header;
+    bool current = readHeader(pending.getData(), pending.getSize(), header) && header.generation == generation;
+    pending.close();
+
+    if (!current || rename(nextName.c_str(), filename.c_str()) != 0) remove(nextName.c_str());
+    else MappedFile::syncDirectory(filename);
+}
+
+/**
+ * Closes and removes a new journal that wasn't moved
+ * into place. The journal lock must be held.
+ */
+void Journal::discardRotation(){
+    if (nextDescriptor == -1) return;
+
+    ::close(nextDescriptor);
+    nextDescriptor = -1;
+    remove((filename + ".next").c_str());
+}
+
+/**
+ * Reads and checks the header of a journal.
+ * @param data The journal contents.
+ * @param size The size of the journal.
+ * @param header Gets the header.
+ * @return Boolean indicating whether it is a journal.
+ */
+bool Journal::readHeader(const char* data, size_t size, JournalHeader& header){
+    if (size < sizeof(header)) return false;
+
+    memcpy(&header, data, sizeof(header));
+    return memcmp(header.magic, "SBARJRNL", 8) == 0 && header.byteOrder == ENDIAN_CHECK &&
+           header.version == VERSION;
+}
+
+/**
+ * Writes and syncs the header of a new journal.
+ * @param descriptor The file to write to.
+ * @param generation The snapshot generation of the journal.
+ * @return Boolean indicating success.
+ */
+bool Journal::writeHeader(int descriptor, uint64_t generation){
+    JournalHeader header;
+    memcpy(header.magic, "SBARJRNL", 8);
+    header.version = VERSION;
+    header.byteOrder = ENDIAN_CHECK;
+    header.generation = generation;
+
+    return writeAll(descriptor, (const char*) &header, sizeof(header)) && fsync(descriptor) == 0;
+}
+
+/**
+ * Logs a record holding an amount and a list of slots.
+ * The journal lock must be held.
+ * @param type The type of record.
+ * @param amount The revenue or cost.
+ * @param items The stock that was taken or bought.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::logItems(uint32_t type, float amount, const vector<BillItem>& items){
+    if (descriptor == -1) return false;
+
+    uint32_t count = items.size();
+    beginRecord(type);
+    addBytes(&amount, sizeof(amount));
+    addBytes(&count, sizeof(count));
+    addBytes(items.data(), count * sizeof(BillItem));
+    return endRecord();
+}
+
+/**
+ * Starts a record in the buffer. The header is
+ * filled in once the record is finished.
+ * @param type The type of record.
+ */
+void Journal::beginRecord(uint32_t type){
+    JournalRecord record;
+    record.type = type;
+    record.size = 0;
+    record.checksum = 0;
+
+    recordStart = buffer.size();
+    addBytes(&record, sizeof(record));
+}
+
+/**
+ * Adds bytes to the record being built.
+ * @param data The bytes to add.
+ * @param size The number of bytes.
+ */
+void Journal::addBytes(const void* data, size_t size){
+    buffer.append((const char*) data, size);
+}
+
+/**
+ * Finishes the record being built. Writes the group out
+ * once it is full or due for an fsync.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::endRecord(){
+    JournalRecord record;
+    memcpy(&record, &buffer[recordStart], sizeof(record));
+    record.size = buffer.size() - recordStart - sizeof(record);
+    record.checksum = checksum(record.type, buffer.data() + recordStart + sizeof(record), record.size);
+    memcpy(&buffer[recordStart], &record, sizeof(record));
+
+    if (syncInterval > 0 && ++unsynced >= syncInterval) return writeBuffer(true);
+    if (buffer.size() >= BUFFER_SIZE) return writeBuffer(false);
+
+    return healthy;
+}
+
+/**
+ * Writes the buffered records to the file.
+ * @param sync Whether to fsync afterwards.
+ * @return Boolean indicating whether the journal is healthy.
+ */
+bool Journal::writeBuffer(bool sync){
+    if (healthy) healthy = writeAll(descriptor, buffer.data(), buffer.size());
+    buffer.clear();
+
+    if (sync && healthy){
+        healthy = fsync(descriptor) == 0;
+        unsynced = 0;
+    }
+
+    return healthy;
+}
+
+/**
+ * Writes every byte, retrying short writes.
+ * @param descriptor The file to write to.
+ * @param data The bytes to write.
+ * @param size The number of bytes.
+ * @return Boolean indicating success.
+ */
+bool Journal::writeAll(int descriptor, const char* data, size_t size){
+    size_t written = 0;
+    while (written < size){
+        ssize_t result = write(descriptor, data + written, size - written);
+        if (result < 0 && errno != EINTR) return false;
+        if (result > 0) written += result;
+    }
+
+    return true;
+}
+
+/**
+ * Works out the FNV-1a checksum of a record.
+ * @param type The type of record.
+ * @param data The record contents.
+ * @param size The size of the contents.
+ * @return The checksum.
+ */
+uint32_t Journal::checksum(uint32_t type, const char* data, size_t size){
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < sizeof(type); i++){
+        hash = (hash ^ ((type >> (i * 8)) & 0xFF)) * 16777619u;
+    }
+    for (size_t i = 0; i < size; i++){
+        hash = (hash ^ (unsigned char) data[i]) * 16777619u;
+    }
+
+    return hash;
+}
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Journal.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Append-only journal of everything that changes the bar since the last
+// snapshot. Records are compact binary and checksummed, written in groups
+// with a configurable number of records between each fsync. The header
+// names the snapshot generation the journal replays onto.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_JOURNAL_H
+#define SANDWICH_BAR_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+#include "../Capital/RestockPlanner.h"
+#include "../FoodItems/BillOfMaterials.h"
+
+struct JournalHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t generation;
+};
+
+struct JournalRecord {
+    uint32_t type;
+    uint32_t size;
+    uint32_t checksum;
+};
+
+struct JournalEntry {
+    uint32_t type;
+    const char* data;
+    uint32_t size;
+};
+
+class Journal {
+public:
+    /** Record Types */
+    static const uint32_t ORDER_RECORD = 1;
+    static const uint32_t RESTOCK_RECORD = 2;
+    static const uint32_t INGREDIENT_RECORD = 3;
+    static const uint32_t RECIPE_RECORD = 4;
+    static const uint32_t CATALOG_RECORD = 5;
+    static const uint32_t PRICE_RECORD = 6;
+
+    /** Constructor/Destructor */
+    Journal();
+    ~Journal();
+
+    /** File Methods */
+    bool open(const std::string& filename, uint64_t generation, std::string* msg);
+    void close();
+    bool isOpen();
+    uint64_t getGeneration();
+
+    /** Rotation Methods */
+    bool beginRotation(uint64_t generation);
+    bool finishRotation();
+    void cancelRotation();
+
+    /** Recovery Methods */
+    bool next(JournalEntry& entry);
+    int getRecovered();
+    bool wasTruncated();
+    static bool readItems(const JournalEntry& entry, float& amount, std::vector<BillItem>& items);
+    static bool readCatalog(const JournalEntry& entry, bool& parallel, const char*& text, size_t& size);
+
+    /** Log Methods */
+    bool logOrder(const BillOfMaterials& bill, float revenue);
+    bool logRestock(const std::vector<RestockItem>& purchases, float cost);
+    bool logText(uint32_t type, const std::string& text);
+    bool logCatalog(const char* data, size_t size, bool parallel);
+
+    /** Sync Methods */
+    void setSyncInterval(int records);
+    bool flush();
+
+private:
+    /** Private Variables */
+    std::string filename;
+    uint64_t generation;
+    int descriptor;
+    int syncInterval;
+    int unsynced;
+    bool healthy;
+    std::string buffer;
+    size_t recordStart;
+    std::vector<BillItem> restockItems;
+    std::mutex journalLock;
+
+    /** Rotation Variables */
+    int nextDescriptor;
+    uint64_t nextGeneration;
+
+    /** Recovery Variables */
+    MappedFile existing;
+    size_t readOffset;
+    size_t validEnd;
+    int recovered;
+    bool truncated;
+
+    /** Helper Methods */
+    bool scan(std::string* msg);
+    void finishCrashedRotation();
+    void discardRotation();
+    bool logItems(uint32_t type, float amount, const std::vector<BillItem>& items);
+    void beginRecord(uint32_t type);
+    void addBytes(const void* data, size_t size);
+    bool endRecord();
+    bool writeBuffer(bool sync);
+    static bool readHeader(const char* data, size_t size, JournalHeader& header);
+    static bool writeHeader(int descriptor, uint64_t generation);
+    static bool writeAll(int descriptor, const char* data, size_t size);
+    static uint32_t checksum(uint32_t type, const char* data, size_t size);
+
+    /** Format Constants */
+    static const uint32_t VERSION = 2;
+    static const uint32_t ENDIAN_CHECK = 0x01020304;
+    static const size_t BUFFER_SIZE = 65536;
+};
+
+
+#endif //SANDWICH_BAR_JOURNAL_H
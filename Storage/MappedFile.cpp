@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFile.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Maps a whole file into memory read-only so it can be parsed in
+// place. The mapping is released when the file is closed.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MappedFile.h"
+
+using namespace std;
+
+/**
+ * Creates a file that isn't open.
+ */
+MappedFile::MappedFile(){
+    descriptor = -1;
+    data = NULL;
+    size = 0;
+}
+
+/**
+ * Closes the file if it is still open.
+ */
+MappedFile::~MappedFile(){
+    close();
+}
+
+/**
+ * Opens a file and maps all of it into memory.
+ * An empty file opens with no data.
+ * @param filename The file to open.
+ * @return Boolean indicating success.
+ */
+bool MappedFile::open(const string& filename){
+    close();
+
+    descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor == -1) return false;
+
+    //Only regular files can be mapped.
+    struct stat info;
+    if (fstat(descriptor, &info) == -1 || !S_ISREG(info.st_mode)){
+        close();
+        return false;
+    }
+
+    size = info.st_size;
+    if (size == 0) return true;
+
+    void* mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapping == MAP_FAILED){
+        close();
+        return false;
+    }
+
+    //The catalog is read front to back once.
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    data = (char*) mapping;
+    return true;
+}
+
+/**
+ * Unmaps and closes the file.
+ */
+void MappedFile::close(){
+    if (data != NULL) munmap(data, size);
+    if (descriptor != -1) ::close(descriptor);
+
+    descriptor = -1;
+    data = NULL;
+    size = 0;
+}
+
+/**
+ * Gets the contents of the file.
+ * @return The first character or NULL if empty.
+ */
+const char* MappedFile::getData() const {
+    return data;
+}
+
+/**
+ * Gets the size of the file.
+ * @return The number of characters.
+ */
+size_t MappedFile::getSize() const {
+    return size;
+}
+
+/**
+ * Syncs the directory holding a file so a file that was
+ * just created or renamed there survives a crash.
+ * @param filename The file whose directory is synced.
+ * @return Boolean indicating success.
+ */
+bool MappedFile::syncDirectory(const string& filename){
+    size_t slash = filename.find_last_of('/');
+    string directory = ".";
+    if (slash == 0) directory = "/";
+    else if (slash != string::npos) directory = filename.substr(0, slash);
+
+    int descriptor = ::open(directory.c_str(), O_RDONLY);
+    if (descriptor == -1) return false;
+
+    bool synced = fsync(descriptor) == 0;
+    ::close(descriptor);
+    return synced;
+}
@@ -0,0 +1,42 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFile.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Maps a whole file into memory read-only so it can be parsed in
+// place. The mapping is released when the file is closed.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_MAPPEDFILE_H
+#define SANDWICH_BAR_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    /** Constructor/Destructor */
+    MappedFile();
+    ~MappedFile();
+
+    /** File Methods */
+    bool open(const std::string& filename);
+    void close();
+
+    /** Data Methods */
+    const char* getData() const;
+    size_t getSize() const;
+
+    /** Sync Methods */
+    static bool syncDirectory(const std::string& filename);
+
+private:
+    /** Private Variables */
+    int descriptor;
+    char* data;
+    size_t size;
+};
+
+
+#endif //SANDWICH_BAR_MAPPEDFILE_H
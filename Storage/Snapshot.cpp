@@ -0,0 +1,472 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Snapshot.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Versioned binary snapshot of a whole sandwich bar. Every record has
+// a fixed size and refers to names and ingredient lists by offset, so
+// a mapped snapshot is read in place without any text parsing.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include "MappedFile.h"
+#include "Snapshot.h"
+#include "../Capital/ComplexRecipe.h"
+#include "../FoodItems/ComplexIngredient.h"
+
+using namespace std;
+
+/**
+ * Creates a snapshot of an inventory and a recipe
+ * catalog. Loading adds to both of them, so they
+ * should be empty.
+ * @param inventory The inventory to save or fill.
+ * @param recipes The catalog to save or fill.
+ */
+Snapshot::Snapshot(Inventory* inventory, RecipeCatalog* recipes){
+    this->inventory = inventory;
+    this->recipes = recipes;
+    funds = 0;
+    generation = 0;
+}
+
+/**
+ * Default destructor. Nothing is owned.
+ */
+Snapshot::~Snapshot(){ }
+
+/**
+ * Writes the bar out to a snapshot file. The file is
+ * written and synced beside the target, then renamed
+ * over it, so a failed save or a crash never leaves
+ * half a snapshot behind.
+ * @param filename The file to write.
+ * @param name The name of the bar.
+ * @param funds The funds of the bar.
+ * @param generation The generation of the snapshot.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Snapshot::save(const string& filename, const string& name, float funds, uint64_t generation, string* msg){
+    string data;
+    if (!write(data, name, funds, generation, msg)) return false;
+
+    //Writes the file and moves it into place.
+    string tempName = filename + ".tmp";
+    int descriptor = ::open(tempName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    bool written = descriptor != -1;
+
+    size_t offset = 0;
+    while (written && offset < data.size()){
+        ssize_t result = ::write(descriptor, data.data() + offset, data.size() - offset);
+        if (result < 0 && errno != EINTR) written = false;
+        if (result > 0) offset += result;
+    }
+    written = written && fsync(descriptor) == 0;
+    if (descriptor != -1) written = ::close(descriptor) == 0 && written;
+
+    if (!written || rename(tempName.c_str(), filename.c_str()) != 0 || !MappedFile::syncDirectory(filename)){
+        remove(tempName.c_str());
+        *msg = "Snapshot could not be written.";
+        return false;
+    }
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Lays the bar out as snapshot bytes in memory.
+ * @param data Gets the snapshot contents.
+ * @param name The name of the bar.
+ * @param funds The funds of the bar.
+ * @param generation The generation of the snapshot.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Snapshot::write(string& data, const string& name, float funds, uint64_t generation, string* msg){
+    vector<SnapshotIngredient> ingredients;
+    vector<SnapshotRecipe> recipeRecords;
+    vector<uint32_t> ids;
+    string strings;
+
+    //Numbers the ingredients by their place in the pantry.
+    unordered_map<Ingredient*, uint32_t> ingredientIds;
+    for (int i = 0; i < inventory->getInventorySize(); i++){
+        ingredientIds[inventory->getIngredient(i)] = i;
+    }
+
+    //Writes out the ingredients.
+    for (int i = 0; i < inventory->getInventorySize(); i++){
+        Ingredient* current = inventory->getIngredient(i);
+        ComplexIngredient* complex = dynamic_cast<ComplexIngredient*>(current);
+
+        SnapshotIngredient record;
+        string ingName = current->getName();
+        record.nameOffset = addString(strings, ingName);
+        record.nameLength = ingName.length();
+        record.firstId = ids.size();
+
+        if (complex == NULL){
+            record.kind = SIMPLE_KIND;
+            record.quantity = current->getQuantity();
+            record.cost = current->getCost();
+        } else {
+            record.kind = COMPLEX_KIND;
+            record.quantity = 0;
+            record.cost = complex->getPremium();
+
+            if (!addIds(complex->getBasedOn(), ingredientIds, ids)){
+                *msg = "Ingredient " + ingName + " uses a removed ingredient.";
+                return false;
+            }
+        }
+
+        record.idCount = ids.size() - record.firstId;
+        ingredients.push_back(record);
+    }
+
+    //Writes out the recipes.
+    for (int i = 0; i < recipes->getSize(); i++){
+        Recipe* current = recipes->getRecipe(i);
+        ComplexRecipe* complex = dynamic_cast<ComplexRecipe*>(current);
+
+        SnapshotRecipe record;
+        string recipeName = current->getName();
+        record.nameOffset = addString(strings, recipeName);
+        record.nameLength = recipeName.length();
+        record.premium = current->getPremium();
+        record.kind = (complex == NULL) ? SIMPLE_KIND : COMPLEX_KIND;
+        record.base = -1;
+
+        vector<Ingredient*> removed;
+        if (complex != NULL){
+            record.base = recipes->getRecipeId(complex->getBaseRecipe()->getName());
+            removed = complex->getRemovedIngredients();
+        }
+
+        //Every ingredient must still be in the pantry.
+        record.firstId = ids.size();
+        bool valid = addIds(current->getOwnIngredients(), ingredientIds, ids);
+        record.idCount = ids.size() - record.firstId;
+
+        record.firstRemoved = ids.size();
+        valid = valid && addIds(removed, ingredientIds, ids);
+        record.removedCount = ids.size() - record.firstRemoved;
+
+        if (!valid){
+            *msg = "Recipe " + recipeName + " uses a removed ingredient.";
+            return false;
+        }
+
+        recipeRecords.push_back(record);
+    }
+
+    //Lays out the sections one after the other.
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "SBARSNAP", 8);
+    header.version = VERSION;
+    header.byteOrder = ENDIAN_CHECK;
+    header.generation = generation;
+    header.funds = funds;
+    header.nameOffset = addString(strings, name);
+    header.nameLength = name.length();
+    header.numIngredients = ingredients.size();
+    header.ingredientOffset = sizeof(SnapshotHeader);
+    header.numRecipes = recipeRecords.size();
+    header.recipeOffset = header.ingredientOffset + ingredients.size() * sizeof(SnapshotIngredient);
+    header.numIds = ids.size();
+    header.idOffset = header.recipeOffset + recipeRecords.size() * sizeof(SnapshotRecipe);
+    header.stringSize = strings.size();
+    header.stringOffset = header.idOffset + ids.size() * sizeof(uint32_t);
+
+    data.assign((const char*) &header, sizeof(header));
+    data.append((const char*) ingredients.data(), ingredients.size() * sizeof(SnapshotIngredient));
+    data.append((const char*) recipeRecords.data(), recipeRecords.size() * sizeof(SnapshotRecipe));
+    data.append((const char*) ids.data(), ids.size() * sizeof(uint32_t));
+    data.append(strings);
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Loads a snapshot into the inventory and catalog, which
+ * must both be empty. Every offset is checked against the
+ * size before it is followed. The data must be 8-byte aligned, which
+ * a mapped file or a heap buffer always is.
+ * @param data The snapshot contents.
+ * @param size The size of the snapshot.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Snapshot::load(const char* data, size_t size, string* msg){
+    if (inventory->getInventorySize() != 0 || recipes->getSize() != 0){
+        *msg = "Snapshots can only be loaded into an empty bar.";
+        return false;
+    } else if (size < sizeof(SnapshotHeader)){
+        *msg = "Not a sandwich bar snapshot.";
+        return false;
+    }
+
+    const SnapshotHeader* header = (const SnapshotHeader*) data;
+    if (!checkHeader(header, size, msg)) return false;
+
+    //Reads in the bar information.
+    if (!readString(header, data, header->nameOffset, header->nameLength, name)){
+        *msg = "Snapshot is corrupt.";
+        return false;
+    }
+    funds = header->funds;
+    generation = header->generation;
+
+    if (!loadIngredients(header, data, msg)) return false;
+    if (!loadRecipes(header, data, msg)) return false;
+
+    *msg = "";
+    return true;
+}
+
+/**
+ * Gets the bar name from the last load.
+ * @return The bar name.
+ */
+string Snapshot::getName(){
+    return name;
+}
+
+/**
+ * Gets the bar funds from the last load.
+ * @return The bar funds.
+ */
+float Snapshot::getFunds(){
+    return funds;
+}
+
+/**
+ * Gets the generation from the last load. A journal
+ * only replays onto the snapshot it was started for.
+ * @return The snapshot generation.
+ */
+uint64_t Snapshot::getGeneration(){
+    return generation;
+}
+
+/**
+ * Checks the header of a snapshot and makes sure
+ * every section fits inside the file.
+ * @param header The header to check.
+ * @param size The size of the snapshot.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating whether it is valid.
+ */
+bool Snapshot::checkHeader(const SnapshotHeader* header, size_t size, string* msg){
+    if (memcmp(header->magic, "SBARSNAP", 8) != 0){
+        *msg = "Not a sandwich bar snapshot.";
+        return false;
+    } else if (header->byteOrder != ENDIAN_CHECK){
+        *msg = "Snapshot was written on a different platform.";
+        return false;
+    } else if (header->version != VERSION){
+        *msg = "Unsupported snapshot version " + to_string(header->version) + ".";
+        return false;
+    }
+
+    //Every section has to fit in the file.
+    uint64_t ends[4] = {
+            header->ingredientOffset + (uint64_t) header->numIngredients * sizeof(SnapshotIngredient),
+            header->recipeOffset + (uint64_t) header->numRecipes * sizeof(SnapshotRecipe),
+            header->idOffset + (uint64_t) header->numIds * sizeof(uint32_t),
+            header->stringOffset + (uint64_t) header->stringSize
+    };
+    uint32_t offsets[3] = {header->ingredientOffset, header->recipeOffset, header->idOffset};
+
+    for (int i = 0; i < 4; i++){
+        if (ends[i] > size || (i < 3 && offsets[i] % 4 != 0)){
+            *msg = "Snapshot is corrupt.";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Adds every ingredient in the snapshot to the inventory.
+ * A complex ingredient may only use ingredients that come
+ * before it.
+ * @param header The header of the snapshot.
+ * @param data The snapshot contents.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Snapshot::loadIngredients(const SnapshotHeader* header, const char* data, string* msg){
+    const SnapshotIngredient* records = (const SnapshotIngredient*) (data + header->ingredientOffset);
+    const uint32_t* ids = (const uint32_t*) (data + header->idOffset);
+    string ingName;
+
+    for (uint32_t i = 0; i < header->numIngredients; i++){
+        const SnapshotIngredient& record = records[i];
+        if (!readString(header, data, record.nameOffset, record.nameLength, ingName)){
+            *msg = "Snapshot is corrupt.";
+            return false;
+        }
+
+        bool added;
+        if (record.kind == SIMPLE_KIND){
+            added = inventory->addSimpleIngredient(ingName, record.quantity, record.cost);
+        } else if (record.kind == COMPLEX_KIND){
+            vector<Ingredient*>* basedOn = new vector<Ingredient*>();
+            if (record.idCount == 0 ||
+                !readIds(ids, record.firstId, record.idCount, header->numIds, i, *basedOn, inventory)){
+                delete basedOn;
+                *msg = "Snapshot is corrupt.";
+                return false;
+            }
+
+            added = inventory->addComplexIngredient(ingName, record.cost, basedOn);
+            if (!added) delete basedOn;
+        } else {
+            *msg = "Snapshot is corrupt.";
+            return false;
+        }
+
+        if (!added){
+            *msg = "Ingredient " + ingName + " already exists.";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Adds every recipe in the snapshot to the catalog.
+ * A complex recipe may only be based on a recipe that
+ * comes before it.
+ * @param header The header of the snapshot.
+ * @param data The snapshot contents.
+ * @param msg A string that will have an error message returned.
+ * @return Boolean indicating success.
+ */
+bool Snapshot::loadRecipes(const SnapshotHeader* header, const char* data, string* msg){
+    const SnapshotRecipe* records = (const SnapshotRecipe*) (data + header->recipeOffset);
+    const uint32_t* ids = (const uint32_t*) (data + header->idOffset);
+    string recipeName;
+
+    for (uint32_t i = 0; i < header->numRecipes; i++){
+        const SnapshotRecipe& record = records[i];
+        vector<Ingredient*> own;
+        vector<Ingredient*> removed;
+
+        //Checks everything the recipe refers to.
+        bool valid = readString(header, data, record.nameOffset, record.nameLength, recipeName) &&
+                     readIds(ids, record.firstId, record.idCount, header->numIds,
+                             header->numIngredients, own, inventory) &&
+                     readIds(ids, record.firstRemoved, record.removedCount, header->numIds,
+                             header->numIngredients, removed, inventory);
+        if (record.kind == COMPLEX_KIND){
+            valid = valid && record.base >= 0 && (uint32_t) record.base < i;
+        } else if (record.kind != SIMPLE_KIND){
+            valid = false;
+        }
+
+        if (!valid){
+            *msg = "Snapshot is corrupt.";
+            return false;
+        } else if (recipes->exists(recipeName)){
+            *msg = "Recipe " + recipeName + " already exists.";
+            return false;
+        }
+
+        //Creates the recipe.
+        if (record.kind == SIMPLE_KIND){
+            recipes->addRecipe(new Recipe(recipeName, own, record.premium, inventory->getIndex()));
+        } else {
+            Recipe* base = recipes->getRecipe(record.base);
+            recipes->addRecipe(new ComplexRecipe(recipeName, own, base, removed, record.premium,
+                                                 inventory->getIndex()));
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Adds the ids of a list of ingredients to the id section.
+ * @param list The ingredients to add.
+ * @param ingredientIds The id of every ingredient in the pantry.
+ * @param ids The id section.
+ * @return Boolean indicating whether every ingredient had an id.
+ */
+bool Snapshot::addIds(const vector<Ingredient*>& list,
+                      const unordered_map<Ingredient*, uint32_t>& ingredientIds,
+                      vector<uint32_t>& ids){
+    for (int i = 0; i < list.size(); i++){
+        unordered_map<Ingredient*, uint32_t>::const_iterator it = ingredientIds.find(list.at(i));
+        if (it == ingredientIds.end()) return false;
+
+        ids.push_back(it->second);
+    }
+
+    return true;
+}
+
+/**
+ * Reads a list of ingredient ids into ingredients.
+ * @param ids The id section of the snapshot.
+ * @param first The first id in the list.
+ * @param count The number of ids in the list.
+ * @param numIds The size of the id section.
+ * @param limit Every id must be below this.
+ * @param list The list to add the ingredients to.
+ * @param inventory The inventory the ids refer to.
+ * @return Boolean indicating whether every id was valid.
+ */
+bool Snapshot::readIds(const uint32_t* ids, uint32_t first, uint32_t count, uint32_t numIds,
+                       uint32_t limit, vector<Ingredient*>& list, Inventory* inventory){
+    if ((uint64_t) first + count > numIds) return false;
+
+    for (uint32_t i = first; i < first + count; i++){
+        if (ids[i] >= limit) return false;
+        list.push_back(inventory->getIngredient((int) ids[i]));
+    }
+
+    return true;
+}
+
+/**
+ * Reads a string out of the string section.
+ * @param header The header of the snapshot.
+ * @param data The snapshot contents.
+ * @param offset Where the string starts in the section.
+ * @param length The length of the string.
+ * @param text The string to copy into.
+ * @return Boolean indicating whether it was in bounds.
+ */
+bool Snapshot::readString(const SnapshotHeader* header, const char* data,
+                          uint32_t offset, uint32_t length, string& text){
+    if ((uint64_t) offset + length > header->stringSize) return false;
+
+    text.assign(data + header->stringOffset + offset, length);
+    return true;
+}
+
+/**
+ * Adds a string to the string section.
+ * @param strings The string section.
+ * @param text The string to add.
+ * @return Where the string starts in the section.
+ */
+uint32_t Snapshot::addString(string& strings, const string& text){
+    uint32_t offset = strings.size();
+    strings += text;
+
+    return offset;
+}
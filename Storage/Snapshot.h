@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Snapshot.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Versioned binary snapshot of a whole sandwich bar. Every record has
+// a fixed size and refers to names and ingredient lists by offset, so
+// a mapped snapshot is read in place without any text parsing.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_SNAPSHOT_H
+#define SANDWICH_BAR_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../Capital/RecipeCatalog.h"
+#include "../FoodItems/Inventory.h"
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t generation;
+    float funds;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t numIngredients;
+    uint32_t ingredientOffset;
+    uint32_t numRecipes;
+    uint32_t recipeOffset;
+    uint32_t numIds;
+    uint32_t idOffset;
+    uint32_t stringSize;
+    uint32_t stringOffset;
+};
+
+struct SnapshotIngredient {
+    uint32_t kind;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    int32_t quantity;
+    float cost;
+    uint32_t firstId;
+    uint32_t idCount;
+};
+
+struct SnapshotRecipe {
+    uint32_t kind;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    float premium;
+    int32_t base;
+    uint32_t firstId;
+    uint32_t idCount;
+    uint32_t firstRemoved;
+    uint32_t removedCount;
+};
+
+class Snapshot {
+public:
+    /** Constructor/Destructor */
+    Snapshot(Inventory* inventory, RecipeCatalog* recipes);
+    ~Snapshot();
+
+    /** Snapshot Methods */
+    bool save(const std::string& filename, const std::string& name, float funds, uint64_t generation,
+              std::string* msg);
+    bool write(std::string& data, const std::string& name, float funds, uint64_t generation, std::string* msg);
+    bool load(const char* data, size_t size, std::string* msg);
+
+    /** Bar Methods */
+    std::string getName();
+    float getFunds();
+    uint64_t getGeneration();
+
+private:
+    /** Private Variables */
+    Inventory* inventory;
+    RecipeCatalog* recipes;
+    std::string name;
+    float funds;
+    uint64_t generation;
+
+    /** Helper Methods */
+    bool checkHeader(const SnapshotHeader* header, size_t size, std::string* msg);
+    bool loadIngredients(const SnapshotHeader* header, const char* data, std::string* msg);
+    bool loadRecipes(const SnapshotHeader* header, const char* data, std::string* msg);
+    static bool addIds(const std::vector<Ingredient*>& list,
+                       const std::unordered_map<Ingredient*, uint32_t>& ingredientIds,
+                       std::vector<uint32_t>& ids);
+    static bool readIds(const uint32_t* ids, uint32_t first, uint32_t count, uint32_t numIds,
+                        uint32_t limit, std::vector<Ingredient*>& list, Inventory* inventory);
+    static bool readString(const SnapshotHeader* header, const char* data,
+                           uint32_t offset, uint32_t length, std::string& text);
+    static uint32_t addString(std::string& strings, const std::string& text);
+
+    /** Format Constants */
+    static const uint32_t VERSION = 2;
+    static const uint32_t ENDIAN_CHECK = 0x01020304;
+    static const uint32_t SIMPLE_KIND = 0;
+    static const uint32_t COMPLEX_KIND = 1;
+};
+
+
+#endif //SANDWICH_BAR_SNAPSHOT_H
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StringRef.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Non-owning view of a run of characters. Used to tokenize catalog
+// lines in place without copying every token into its own string.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <string.h>
+#include "StringRef.h"
+
+using namespace std;
+
+/**
+ * Creates an empty view.
+ */
+StringRef::StringRef(){
+    data = NULL;
+    length = 0;
+}
+
+/**
+ * Creates a view of some characters.
+ * @param data The first character.
+ * @param length The number of characters.
+ */
+StringRef::StringRef(const char* data, size_t length){
+    this->data = data;
+    this->length = length;
+}
+
+/**
+ * Creates a view of a string. The string
+ * must outlive the view.
+ * @param text The string to view.
+ */
+StringRef::StringRef(const string& text){
+    data = text.data();
+    length = text.length();
+}
+
+/**
+ * Checks whether the view holds exactly some text.
+ * @param text The text to compare against.
+ * @return Boolean indicating whether they match.
+ */
+bool StringRef::equals(const string& text) const {
+    return length == text.length() && memcmp(data, text.data(), length) == 0;
+}
+
+/**
+ * Checks whether the view starts with a prefix.
+ * @param prefix The prefix to look for.
+ * @return Boolean indicating whether it starts with it.
+ */
+bool StringRef::startsWith(const char* prefix) const {
+    size_t prefixLength = strlen(prefix);
+    return length >= prefixLength && memcmp(data, prefix, prefixLength) == 0;
+}
+
+/**
+ * Checks whether the view ends with a character.
+ * @param end The character to look for.
+ * @return Boolean indicating whether it ends with it.
+ */
+bool StringRef::endsWith(char end) const {
+    return length > 0 && data[length - 1] == end;
+}
+
+/**
+ * Copies the view into an existing string. Reusing
+ * the same string avoids allocating for every copy.
+ * @param out The string to copy into.
+ */
+void StringRef::copyTo(string& out) const {
+    out.assign(data, length);
+}
+
+/**
+ * Copies the view into a new string.
+ * @return The new string.
+ */
+string StringRef::str() const {
+    return string(data, length);
+}
+
+/**
+ * Checks whether two views hold the same characters.
+ * @param first The first view.
+ * @param second The second view.
+ * @return Boolean indicating whether they match.
+ */
+bool operator==(const StringRef& first, const StringRef& second){
+    return first.length == second.length && memcmp(first.data, second.data, first.length) == 0;
+}
+
+/**
+ * Hashes the characters of a view using FNV-1a so
+ * views can key a hash map without being copied.
+ * @param text The view to hash.
+ * @return The hash of the characters.
+ */
+size_t StringRefHash::operator()(const StringRef& text) const {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < text.length; i++){
+        hash ^= (unsigned char) text.data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return (size_t) hash;
+}
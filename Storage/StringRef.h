@@ -0,0 +1,45 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StringRef.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Non-owning view of a run of characters. Used to tokenize catalog
+// lines in place without copying every token into its own string.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_STRINGREF_H
+#define SANDWICH_BAR_STRINGREF_H
+
+#include <cstddef>
+#include <string>
+
+struct StringRef {
+    /** Constructors */
+    StringRef();
+    StringRef(const char* data, size_t length);
+    StringRef(const std::string& text);
+
+    /** Compare Methods */
+    bool equals(const std::string& text) const;
+    bool startsWith(const char* prefix) const;
+    bool endsWith(char end) const;
+
+    /** Convert Methods */
+    void copyTo(std::string& out) const;
+    std::string str() const;
+
+    /** View */
+    const char* data;
+    size_t length;
+};
+
+/** Hash Support */
+bool operator==(const StringRef& first, const StringRef& second);
+
+struct StringRefHash {
+    size_t operator()(const StringRef& text) const;
+};
+
+
+#endif //SANDWICH_BAR_STRINGREF_H
@@ -0,0 +1,221 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CompactOrderTest.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Checks that a compact order prints, costs and bills the same as the
+// order it was made from, that chained removal lists and large counts
+// are kept, and that an order held across a reload is refused instead
+// of made while removing an unrelated item is not.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Customers/CompactOrder.h"
+#include "../FoodItems/SimpleIngredient.h"
+#include "../Simulation/OrderGenerator.h"
+#include "TestCatalog.h"
+
+using namespace std;
+
+/** Test Constants */
+const int NUM_ORDERS = 500;
+
+/**
+ * Checks whether two bills use the same stock.
+ * @param first The first bill.
+ * @param second The second bill.
+ * @return Boolean indicating whether they match.
+ */
+bool sameBill(BillOfMaterials& first, BillOfMaterials& second){
+    first.compact();
+    second.compact();
+
+    const vector<BillItem>& a = first.getItems();
+    const vector<BillItem>& b = second.getItems();
+    if (a.size() != b.size()) return false;
+    for (int i = 0; i < a.size(); i++){
+        if (a[i].slot != b[i].slot || a[i].count != b[i].count) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Checks that generated orders and their compact forms print,
+ * cost and bill the same.
+ * @return The number of failures.
+ */
+int checkEquivalence(){
+    Inventory inventory;
+    RecipeCatalog recipes;
+    if (!loadTestCatalog(&inventory, &recipes, 1000, 0)) return 1;
+
+    OrderGenerator generator(&recipes, &inventory, 11);
+    generator.setSubstitutionRate(0.8);
+    generator.setMaxSubstitutions(4);
+
+    int failures = 0;
+    for (int i = 0; i < NUM_ORDERS && failures < 5; i++){
+        Order* order = generator.generateOrder();
+        CompactOrder compact(order);
+
+        BillOfMaterials orderBill;
+        BillOfMaterials compactBill;
+        order->appendBill(orderBill);
+        compact.appendBill(compactBill);
+
+        if (compact.printOrder() != order->printOrder()){
+            cout << "FAIL: order " << i << " prints differently." << endl;
+            failures++;
+        } else if (compact.getTotalCost() != order->getTotalCost()){
+            cout << "FAIL: order " << i << " costs " << compact.getTotalCost()
+                 << " but should cost " << order->getTotalCost() << "." << endl;
+            failures++;
+        } else if (!sameBill(orderBill, compactBill)){
+            cout << "FAIL: order " << i << " bills differently." << endl;
+            failures++;
+        }
+
+        delete order;
+    }
+
+    return failures;
+}
+
+/**
+ * Checks that removals in a chained view are all kept.
+ * @return The number of failures.
+ */
+int checkChainedRemovals(){
+    Inventory inventory;
+    RecipeCatalog recipes;
+    if (!loadTestCatalog(&inventory, &recipes, 1000, 0)) return 1;
+
+    Recipe* recipe = recipes.getRecipe("r5");
+    vector<Ingredient*> first;
+    vector<Ingredient*> second;
+    first.push_back(inventory.getIngredient("s5"));
+    second.push_back(inventory.getIngredient("c0"));
+
+    IngredientSpan removals(first);
+    IngredientSpan rest(second);
+    removals.next = &rest;
+
+    CompactOrder compact("Chained");
+    compact.addSandwich(recipe, IngredientSpan(), removals);
+
+    //The same sandwich as a regular order.
+    Substitution* subs = new Substitution();
+    subs->addRemoval(first.at(0));
+    subs->addRemoval(second.at(0));
+    Order order("Chained");
+    order.addSandwich(new Sandwich(recipe, subs));
+
+    BillOfMaterials orderBill;
+    BillOfMaterials compactBill;
+    order.appendBill(orderBill);
+    compact.appendBill(compactBill);
+
+    if (compact.printOrder() != order.printOrder() || compact.getTotalCost() != order.getTotalCost() ||
+        !sameBill(orderBill, compactBill)){
+        cout << "FAIL: a chained removal was dropped." << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Checks that more additions than fit in a short are kept.
+ * @return The number of failures.
+ */
+int checkLargeCounts(){
+    Inventory inventory;
+    RecipeCatalog recipes;
+    if (!loadTestCatalog(&inventory, &recipes, 1000, 0)) return 1;
+
+    const int count = 70000;
+    vector<Ingredient*> additions(count, inventory.getIngredient("s19"));
+    CompactOrder compact("Large");
+    compact.addSandwich(recipes.getRecipe("r0"), IngredientSpan(additions), IngredientSpan());
+
+    BillOfMaterials bill;
+    compact.appendBill(bill);
+    bill.compact();
+
+    int slot = dynamic_cast<SimpleIngredient*>(inventory.getIngredient("s19"))->getSlot();
+    const vector<BillItem>& items = bill.getItems();
+    for (int i = 0; i < items.size(); i++){
+        if (items[i].slot == slot && items[i].count == count) return 0;
+    }
+
+    cout << "FAIL: " << count << " additions were not all kept." << endl;
+    return 1;
+}
+
+/**
+ * Checks that an order held while the catalog is replaced
+ * is refused rather than made with reused ids.
+ * @return The number of failures.
+ */
+int checkStale(){
+    ReferenceIndex index;
+    Inventory* inventory = new Inventory(&index);
+    RecipeCatalog* recipes = new RecipeCatalog();
+    if (!loadTestCatalog(inventory, recipes, 1000, 0)) return 1;
+
+    CompactOrder compact("Held");
+    compact.addSandwich(recipes->getRecipe("r7"));
+
+    //Nothing in r7 uses s19.
+    int failures = 0;
+    inventory->removeIngredient(inventory->getIngredient("s19"));
+    if (compact.isStale()){
+        cout << "FAIL: removing an unused ingredient made an order stale." << endl;
+        failures++;
+    }
+
+    //Replaces the catalog, so the old ids are handed out again.
+    delete recipes;
+    delete inventory;
+    inventory = new Inventory(&index);
+    recipes = new RecipeCatalog();
+    if (!loadTestCatalog(inventory, recipes, 0, 0)) return 1;
+
+    if (!compact.isStale()){
+        cout << "FAIL: an order held across a reload is not stale." << endl;
+        failures++;
+    }
+    if (compact.makeOrder() || inventory->reserve(&compact)){
+        cout << "FAIL: a stale order was made." << endl;
+        failures++;
+    }
+    compact.printOrder();
+
+    //A cleared order can be used again.
+    compact.clear();
+    compact.addSandwich(recipes->getRecipe("r7"));
+    if (compact.isStale()){
+        cout << "FAIL: a cleared order is still stale." << endl;
+        failures++;
+    }
+
+    delete recipes;
+    delete inventory;
+    return failures;
+}
+
+/**
+ * Runs the test.
+ * @return 0 if every check passed.
+ */
+int main(){
+    int failures = checkEquivalence() + checkChainedRemovals() + checkLargeCounts() + checkStale();
+
+    if (failures > 0) return 1;
+    cout << "CompactOrderTest passed." << endl;
+    return 0;
+}
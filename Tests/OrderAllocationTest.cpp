@@ -0,0 +1,158 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderAllocationTest.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Checks that making an order on a warm bar never touches the heap. The
+// global operator new is replaced so every allocation made while orders
+// are being made is counted.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "../Simulation/OrderGenerator.h"
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/** Test Constants */
+const int NUM_ORDERS = 2000;
+const int NUM_ROUNDS = 3;
+
+/** Allocation Counting */
+bool counting = false;
+long long allocations = 0;
+
+/**
+ * Allocates memory and counts it while counting is on.
+ * @param size The number of bytes.
+ * @return The memory.
+ */
+void* operator new(size_t size){
+    if (counting) allocations++;
+
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == NULL) throw bad_alloc();
+    return memory;
+}
+
+/**
+ * Allocates an array and counts it while counting is on.
+ * @param size The number of bytes.
+ * @return The memory.
+ */
+void* operator new[](size_t size){
+    return operator new(size);
+}
+
+/**
+ * Frees memory from operator new.
+ * @param memory The memory to free.
+ */
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+/**
+ * Frees memory from operator new[].
+ * @param memory The memory to free.
+ */
+void operator delete[](void* memory) noexcept {
+    free(memory);
+}
+
+/**
+ * Builds catalog text with complex ingredients and complex
+ * recipes so removals are chained through base recipes. One
+ * ingredient is kept short so some orders fail.
+ * @return The catalog text.
+ */
+string buildCatalog(){
+    string text = "BAR\nTest Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < 20; i++){
+        int quantity = i == 0 ? 50 : 100000000;
+        text += "simple,s" + to_string(i) + ",0.50," + to_string(quantity) + "\n";
+    }
+    for (int i = 0; i < 5; i++){
+        text += "complex,c" + to_string(i) + ",0.25,{s" + to_string(i * 3) + ",s" + to_string(i * 3 + 1) + "}\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < 5; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{s" + to_string(i) + ",s" + to_string(i + 5)
+                + ",c" + to_string(i) + "}\n";
+    }
+    for (int i = 5; i < 10; i++){
+        text += "complex,r" + to_string(i) + ",r" + to_string(i - 5) + ",1.00,{s" + to_string(i + 5)
+                + "},{s" + to_string(i - 5) + "}\n";
+    }
+    text += "complex,r10,r5,1.00,{c1},{s10}\n";
+
+    return text;
+}
+
+/**
+ * Runs the test.
+ * @return 0 if every check passed.
+ */
+int main(){
+    Inventory inventory;
+    RecipeCatalog recipes;
+    CatalogLoader loader(&inventory, &recipes);
+
+    string catalog = buildCatalog();
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << "FAIL: " << msg << endl;
+        return 1;
+    }
+
+    OrderGenerator generator(&recipes, &inventory, 7);
+    generator.setSubstitutionRate(0.8);
+    generator.setMaxSubstitutions(4);
+    vector<Order*> orders;
+    for (int i = 0; i < NUM_ORDERS; i++){
+        orders.push_back(generator.generateOrder());
+    }
+
+    //Warms the per-thread scratch bills.
+    for (int i = 0; i < NUM_ORDERS; i++){
+        orders[i]->makeOrder();
+    }
+
+    //Every order is made a few more times while counting.
+    int made = 0;
+    int failed = 0;
+    counting = true;
+    for (int round = 0; round < NUM_ROUNDS; round++){
+        for (int i = 0; i < NUM_ORDERS; i++){
+            if (orders[i]->makeOrder()) made++;
+            else failed++;
+        }
+    }
+    counting = false;
+
+    for (int i = 0; i < NUM_ORDERS; i++){
+        delete orders[i];
+    }
+
+    int failures = 0;
+    if (allocations != 0){
+        cout << "FAIL: " << allocations << " allocations while making "
+             << NUM_ORDERS * NUM_ROUNDS << " orders." << endl;
+        failures++;
+    }
+    if (made == 0 || failed == 0){
+        cout << "FAIL: expected orders that succeed and orders that fail, got "
+             << made << " and " << failed << "." << endl;
+        failures++;
+    }
+
+    if (failures > 0) return 1;
+    cout << "OrderAllocationTest passed." << endl;
+    return 0;
+}
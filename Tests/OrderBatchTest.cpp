@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OrderBatchTest.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Checks batched commits against making the same orders one at a time.
+// A FIFO batch must make exactly the same orders and leave the same stock,
+// with and without shortfalls. A revenue batch must earn at least as much
+// and take only the stock its orders use.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../Customers/OrderBatch.h"
+#include "../Simulation/OrderGenerator.h"
+#include "TestCatalog.h"
+
+using namespace std;
+
+/** Test Constants */
+const int NUM_ORDERS = 400;
+const int SEED = 23;
+
+/**
+ * Holds one bar and the orders generated for it.
+ */
+struct TestBar {
+    Inventory inventory;
+    RecipeCatalog recipes;
+    vector<Order*> orders;
+
+    ~TestBar(){
+        for (int i = 0; i < orders.size(); i++) delete orders[i];
+    }
+};
+
+/**
+ * Loads a bar and generates the same orders every time.
+ * @param bar The bar to fill.
+ * @param stock The quantity of the first simple ingredient.
+ * @return Boolean indicating success.
+ */
+bool setupBar(TestBar& bar, int stock){
+    if (!loadTestCatalog(&bar.inventory, &bar.recipes, stock, 7)) return false;
+
+    OrderGenerator generator(&bar.recipes, &bar.inventory, SEED);
+    generator.setSubstitutionRate(0.5);
+    for (int i = 0; i < NUM_ORDERS; i++){
+        bar.orders.push_back(generator.generateOrder());
+    }
+
+    return true;
+}
+
+/**
+ * Commits the orders of a bar in batches of a set size.
+ * @param bar The bar to commit against.
+ * @param batchSize The number of orders per batch.
+ * @param policy The policy of the batch.
+ * @param outcomes Gets whether each order was made.
+ * @return The revenue of the orders made.
+ */
+float commitBatches(TestBar& bar, int batchSize, int policy, vector<bool>& outcomes){
+    OrderBatch batch(bar.inventory.getStockTable(), policy);
+    float revenue = 0;
+
+    outcomes.clear();
+    for (int first = 0; first < bar.orders.size(); first += batchSize){
+        int last = min(first + batchSize, (int) bar.orders.size());
+        vector<Order*> chunk(bar.orders.begin() + first, bar.orders.begin() + last);
+
+        batch.commit(chunk);
+        revenue += batch.getRevenue();
+        outcomes.insert(outcomes.end(), batch.getOutcomes().begin(), batch.getOutcomes().end());
+    }
+
+    return revenue;
+}
+
+/**
+ * Checks a FIFO batch against making each order in turn.
+ * @param stock The quantity of every simple ingredient.
+ * @param batchSize The number of orders per batch.
+ * @return The number of failures.
+ */
+int checkFifo(int stock, int batchSize){
+    TestBar sequential;
+    TestBar batched;
+    if (!setupBar(sequential, stock) || !setupBar(batched, stock)) return 1;
+
+    vector<bool> expected;
+    int shortfalls = 0;
+    for (int i = 0; i < sequential.orders.size(); i++){
+        expected.push_back(sequential.orders[i]->makeOrder());
+        if (!expected.back()) shortfalls++;
+    }
+
+    vector<bool> outcomes;
+    commitBatches(batched, batchSize, OrderBatch::FIFO, outcomes);
+
+    string label = "stock " + to_string(stock) + ", batches of " + to_string(batchSize);
+    if (outcomes != expected){
+        cout << "FAIL: FIFO outcomes differ with " << label << "." << endl;
+        return 1;
+    }
+
+    StockTable* first = sequential.inventory.getStockTable();
+    StockTable* second = batched.inventory.getStockTable();
+    for (int slot = 0; slot < first->getSize(); slot++){
+        if (first->getQuantity(slot) != second->getQuantity(slot)){
+            cout << "FAIL: slot " << slot << " differs with " << label << "." << endl;
+            return 1;
+        }
+    }
+
+    //A small pantry must actually run short.
+    if (stock < 1000 && shortfalls == 0){
+        cout << "FAIL: no shortfalls with " << label << "." << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Checks that a revenue batch earns at least as much as FIFO
+ * and takes exactly the stock its orders use.
+ * @param stock The quantity of every simple ingredient.
+ * @return The number of failures.
+ */
+int checkRevenue(int stock){
+    TestBar fifo;
+    TestBar best;
+    if (!setupBar(fifo, stock) || !setupBar(best, stock)) return 1;
+
+    vector<bool> fifoOutcomes;
+    vector<bool> outcomes;
+    float fifoRevenue = commitBatches(fifo, NUM_ORDERS, OrderBatch::FIFO, fifoOutcomes);
+    float revenue = commitBatches(best, NUM_ORDERS, OrderBatch::MAX_REVENUE, outcomes);
+
+    if (revenue < fifoRevenue){
+        cout << "FAIL: revenue batch earned less than FIFO with stock " << stock << "." << endl;
+        return 1;
+    }
+
+    //Adds up what the chosen orders use.
+    BillOfMaterials used;
+    for (int i = 0; i < best.orders.size(); i++){
+        if (outcomes[i]) best.orders[i]->appendBill(used);
+    }
+    used.compact();
+
+    TestBar fresh;
+    if (!setupBar(fresh, stock)) return 1;
+    StockTable* start = fresh.inventory.getStockTable();
+    StockTable* end = best.inventory.getStockTable();
+    vector<long long> taken(start->getSize(), 0);
+    for (int i = 0; i < used.getItems().size(); i++){
+        taken[used.getItems()[i].slot] += used.getItems()[i].count;
+    }
+
+    for (int slot = 0; slot < start->getSize(); slot++){
+        if (end->getQuantity(slot) < 0 || start->getQuantity(slot) - taken[slot] != end->getQuantity(slot)){
+            cout << "FAIL: revenue batch took the wrong stock from slot " << slot
+                 << " with stock " << stock << "." << endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Runs the test.
+ * @return 0 if every check passed.
+ */
+int main(){
+    int stocks[] = {40, 150, 1000000};
+    int sizes[] = {1, 7, 50, NUM_ORDERS};
+
+    int failures = 0;
+    for (int i = 0; i < 3; i++){
+        for (int j = 0; j < 4; j++){
+            failures += checkFifo(stocks[i], sizes[j]);
+        }
+        failures += checkRevenue(stocks[i]);
+    }
+
+    if (failures > 0) return 1;
+    cout << "OrderBatchTest passed." << endl;
+    return 0;
+}
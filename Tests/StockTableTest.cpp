@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StockTableTest.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Stress test for the lock-free stock table. Several threads make bills,
+// add stock and take from a shared counter at once. No count may go
+// negative and every unit of stock must be accounted for.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../FoodItems/StockTable.h"
+
+using namespace std;
+
+/** Test Constants */
+const int NUM_THREADS = 8;
+const int NUM_SLOTS = 16;
+const int START_STOCK = 500;
+const int ITERATIONS = 50000;
+const int COUNTER_STOCK = 100000;
+
+/** Shared State */
+StockTable table;
+StockCounter counter(COUNTER_STOCK);
+atomic<bool> running(true);
+atomic<bool> wentNegative(false);
+
+/**
+ * Holds what one thread took and added so the
+ * totals can be checked afterwards.
+ */
+struct ThreadTotals {
+    vector<long long> taken;
+    vector<long long> added;
+    long long counterTaken;
+};
+
+/**
+ * Makes random bills and adds stock now and then.
+ * Also takes from the shared counter one unit at a time.
+ * @param seed The seed for this thread.
+ * @param totals Gets what the thread took and added.
+ */
+void hammer(unsigned int seed, ThreadTotals* totals){
+    mt19937 engine(seed);
+    uniform_int_distribution<int> slotPick(0, NUM_SLOTS - 1);
+    uniform_int_distribution<int> countPick(1, 5);
+    vector<BillItem> items;
+
+    totals->taken.assign(NUM_SLOTS, 0);
+    totals->added.assign(NUM_SLOTS, 0);
+    totals->counterTaken = 0;
+
+    for (int i = 0; i < ITERATIONS; i++){
+        //A bill with up to three different slots.
+        items.clear();
+        int first = slotPick(engine);
+        for (int j = 0; j < 3; j++){
+            BillItem item;
+            item.slot = (first + j * 5) % NUM_SLOTS;
+            item.count = countPick(engine);
+            items.push_back(item);
+        }
+
+        if (table.make(items)){
+            for (int j = 0; j < items.size(); j++){
+                totals->taken[items[j].slot] += items[j].count;
+            }
+        }
+
+        //Restocks a little less often than it takes.
+        if (i % 4 == 0){
+            int slot = slotPick(engine);
+            int amount = countPick(engine) * 2;
+            table.addStock(slot, amount);
+            totals->added[slot] += amount;
+        }
+
+        if (counter.take(1)) totals->counterTaken++;
+    }
+}
+
+/**
+ * Watches every count while the threads run.
+ */
+void watch(){
+    while (running){
+        for (int i = 0; i < NUM_SLOTS; i++){
+            if (table.getQuantity(i) < 0) wentNegative = true;
+        }
+        if (counter.get() < 0) wentNegative = true;
+
+        this_thread::yield();
+    }
+}
+
+/**
+ * Runs the stress test.
+ * @return 0 if every check passed.
+ */
+int main(){
+    for (int i = 0; i < NUM_SLOTS; i++){
+        table.addSlot(START_STOCK, 1.0);
+    }
+
+    vector<ThreadTotals> totals(NUM_THREADS);
+    vector<thread> workers;
+    thread watcher(watch);
+    for (int i = 0; i < NUM_THREADS; i++){
+        workers.push_back(thread(hammer, i + 1, &totals[i]));
+    }
+    for (int i = 0; i < NUM_THREADS; i++){
+        workers[i].join();
+    }
+    running = false;
+    watcher.join();
+
+    int failures = 0;
+    if (wentNegative){
+        cout << "FAIL: a count went negative." << endl;
+        failures++;
+    }
+
+    //Stock in must equal stock out plus what is left.
+    for (int slot = 0; slot < NUM_SLOTS; slot++){
+        long long expected = START_STOCK;
+        for (int i = 0; i < NUM_THREADS; i++){
+            expected += totals[i].added[slot] - totals[i].taken[slot];
+        }
+
+        if (table.getQuantity(slot) != expected){
+            cout << "FAIL: slot " << slot << " has " << table.getQuantity(slot)
+                 << " but should have " << expected << "." << endl;
+            failures++;
+        }
+    }
+
+    long long counterTaken = 0;
+    for (int i = 0; i < NUM_THREADS; i++){
+        counterTaken += totals[i].counterTaken;
+    }
+    if (counter.get() < 0 || counter.get() + counterTaken != COUNTER_STOCK){
+        cout << "FAIL: the counter has " << counter.get() << " after "
+             << counterTaken << " were taken." << endl;
+        failures++;
+    }
+
+    if (failures > 0) return 1;
+    cout << "StockTableTest passed." << endl;
+    return 0;
+}
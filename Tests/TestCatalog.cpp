@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TestCatalog.cpp
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Catalog shared by the order tests. It has 20 simple ingredients,
+// 5 complex ingredients, 5 simple recipes and 5 complex recipes, so
+// removals are chained through base recipes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include "TestCatalog.h"
+#include "../Storage/CatalogLoader.h"
+
+using namespace std;
+
+/**
+ * Builds the catalog text. Simple ingredient i starts
+ * with stock + i * stockStep.
+ * @param stock The quantity of the first simple ingredient.
+ * @param stockStep How much more each following one has.
+ * @return The catalog text.
+ */
+string buildTestCatalog(int stock, int stockStep){
+    string text = "BAR\nTest Bar,1000.00\nINGREDIENT\n";
+    for (int i = 0; i < 20; i++){
+        text += "simple,s" + to_string(i) + ",0.5" + to_string(i % 10) + "," + to_string(stock + i * stockStep) + "\n";
+    }
+    for (int i = 0; i < 5; i++){
+        text += "complex,c" + to_string(i) + ",0.25,{s" + to_string(i * 3) + ",s" + to_string(i * 3 + 1) + "}\n";
+    }
+
+    text += "RECIPE\n";
+    for (int i = 0; i < 5; i++){
+        text += "simple,r" + to_string(i) + ",2.00,{s" + to_string(i) + ",s" + to_string(i + 5)
+                + ",c" + to_string(i) + "}\n";
+    }
+    for (int i = 5; i < 10; i++){
+        text += "complex,r" + to_string(i) + ",r" + to_string(i - 5) + ",1.00,{s" + to_string(i + 5)
+                + "},{s" + to_string(i - 5) + "}\n";
+    }
+
+    return text;
+}
+
+/**
+ * Loads the catalog into an inventory and recipe catalog.
+ * @param inventory The inventory to fill.
+ * @param recipes The recipe catalog to fill.
+ * @param stock The quantity of the first simple ingredient.
+ * @param stockStep How much more each following one has.
+ * @return Boolean indicating success.
+ */
+bool loadTestCatalog(Inventory* inventory, RecipeCatalog* recipes, int stock, int stockStep){
+    CatalogLoader loader(inventory, recipes);
+    string catalog = buildTestCatalog(stock, stockStep);
+    string msg;
+    if (!loader.load(catalog.data(), catalog.size(), &msg)){
+        cout << "FAIL: " << msg << endl;
+        return false;
+    }
+
+    return true;
+}
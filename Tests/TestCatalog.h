@@ -0,0 +1,24 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TestCatalog.h
+//
+// Created By: agent
+// Date: 10/17/2026
+//
+// Catalog shared by the order tests. It has 20 simple ingredients,
+// 5 complex ingredients, 5 simple recipes and 5 complex recipes, so
+// removals are chained through base recipes.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SANDWICH_BAR_TESTCATALOG_H
+#define SANDWICH_BAR_TESTCATALOG_H
+
+#include <string>
+#include "../Capital/RecipeCatalog.h"
+#include "../FoodItems/Inventory.h"
+
+/** Catalog Methods */
+std::string buildTestCatalog(int stock, int stockStep);
+bool loadTestCatalog(Inventory* inventory, RecipeCatalog* recipes, int stock, int stockStep);
+
+
+#endif //SANDWICH_BAR_TESTCATALOG_H
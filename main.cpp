@@ -9,17 +9,218 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <string>
+#include <ctime>
+#include <climits>
+#include <cmath>
 #include "SandwichBar.h"
 
 using namespace std;
 
+/**
+ * Prints how to run the program from
+ * the command line.
+ */
+void printUsage() {
+    cout << "Usage: SandwichBar [options]" << endl
+         << "Runs interactively when no options are given." << endl << endl
+         << "Options:" << endl
+         << "--load <file> : Loads a collection of recipes and ingredients." << endl
+         << "--parallel-load : Loads the file with every thread, allowing forward references." << endl
+         << "--load-snapshot <file> : Replaces the bar with a saved snapshot." << endl
+         << "--save-snapshot <file> : Saves the bar to a snapshot after loading." << endl
+         << "--update-prices <file> : Applies a file of new ingredient prices after loading." << endl
+         << "--journal <file> : Replays a journal after loading and logs every change to it." << endl
+         << "--journal-sync <records> : Records per fsync of the journal, or 0 to never sync. Defaults to 1." << endl
+         << "--simulate <orders> : Simulates orders without prompting." << endl
+         << "--replicas <count> : Runs independent copies of the simulation in parallel." << endl
+         << "--threads <count> : Threads used for replicas and parallel loads. Defaults to every core." << endl
+         << "--seed <seed> : Seed for the simulated orders." << endl
+         << "--popularity <exponent> : Zipf exponent for recipe popularity." << endl
+         << "--substitution-rate <rate> : Chance a sandwich has a substitution." << endl
+         << "--max-sandwiches <count> : Most sandwiches in one order." << endl
+         << "--max-substitutions <count> : Most substitutions on one sandwich." << endl
+         << "--verbose : Prints every simulated order." << endl;
+}
+
+/**
+ * Reads a whole number from a flag value. The whole
+ * value must be a number within the range.
+ * @param value The flag value.
+ * @param minimum The smallest value allowed.
+ * @param maximum The largest value allowed.
+ * @param result Gets the number.
+ * @return Boolean indicating whether the value was valid.
+ */
+bool readNumber(const string& value, long long minimum, long long maximum, long long& result) {
+    size_t end = 0;
+    try {
+        result = stoll(value, &end);
+    } catch (...) {
+        return false;
+    }
+
+    return end == value.size() && result >= minimum && result <= maximum;
+}
+
+/**
+ * Reads a decimal from a flag value. The whole
+ * value must be a number within the range.
+ * @param value The flag value.
+ * @param minimum The smallest value allowed.
+ * @param maximum The largest value allowed.
+ * @param result Gets the number.
+ * @return Boolean indicating whether the value was valid.
+ */
+bool readDecimal(const string& value, double minimum, double maximum, double& result) {
+    size_t end = 0;
+    try {
+        result = stod(value, &end);
+    } catch (...) {
+        return false;
+    }
+
+    return end == value.size() && result >= minimum && result <= maximum;
+}
+
+/**
+ * Runs the sandwich bar without prompting
+ * based on command line arguments.
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @return Program return code.
+ */
+int runHeadless(int argc, char** argv) {
+    SandwichBar bar = SandwichBar();
+    string loadFile;
+    string loadSnapshot;
+    string saveSnapshot;
+    string updatePrices;
+    string journal;
+    int journalSync = 1;
+    bool parallelLoad = false;
+    int replicas = 0;
+    int threads = 0;
+
+    //Default simulation settings.
+    SimulationSettings settings;
+    settings.numOrders = 0;
+    settings.seed = time(NULL);
+    settings.popularity = 0;
+    settings.substitutionRate = 0.5;
+    settings.maxSandwiches = 10;
+    settings.maxSubstitutions = 2;
+    settings.verbose = false;
+
+    //Reads in the arguments.
+    for (int i = 1; i < argc; i++){
+        string flag = argv[i];
+        if (flag.compare("--verbose") == 0){
+            settings.verbose = true;
+            continue;
+        } else if (flag.compare("--parallel-load") == 0){
+            parallelLoad = true;
+            continue;
+        } else if (i + 1 >= argc){
+            printUsage();
+            return 1;
+        }
+
+        string value = argv[++i];
+        long long number = 0;
+        double decimal = 0;
+        bool valid = true;
+        if (flag.compare("--load") == 0){
+            loadFile = value;
+        } else if (flag.compare("--load-snapshot") == 0){
+            loadSnapshot = value;
+        } else if (flag.compare("--save-snapshot") == 0){
+            saveSnapshot = value;
+        } else if (flag.compare("--update-prices") == 0){
+            updatePrices = value;
+        } else if (flag.compare("--journal") == 0){
+            journal = value;
+        } else if (flag.compare("--journal-sync") == 0){
+            valid = readNumber(value, 0, INT_MAX, number);
+            journalSync = number;
+        } else if (flag.compare("--simulate") == 0){
+            valid = readNumber(value, 1, LLONG_MAX, number);
+            settings.numOrders = number;
+        } else if (flag.compare("--replicas") == 0){
+            valid = readNumber(value, 1, INT_MAX, number);
+            replicas = number;
+        } else if (flag.compare("--threads") == 0){
+            valid = readNumber(value, 1, INT_MAX, number);
+            threads = number;
+        } else if (flag.compare("--seed") == 0){
+            valid = readNumber(value, 0, UINT_MAX, number);
+            settings.seed = number;
+        } else if (flag.compare("--popularity") == 0){
+            valid = readDecimal(value, 0, HUGE_VAL, decimal);
+            settings.popularity = decimal;
+        } else if (flag.compare("--substitution-rate") == 0){
+            valid = readDecimal(value, 0, 1, decimal);
+            settings.substitutionRate = decimal;
+        } else if (flag.compare("--max-sandwiches") == 0){
+            valid = readNumber(value, 1, INT_MAX, number);
+            settings.maxSandwiches = number;
+        } else if (flag.compare("--max-substitutions") == 0){
+            valid = readNumber(value, 1, INT_MAX, number);
+            settings.maxSubstitutions = number;
+        } else {
+            printUsage();
+            return 1;
+        }
+
+        if (!valid){
+            cout << "Invalid value for " << flag << "." << endl << endl;
+            printUsage();
+            return 1;
+        }
+    }
+
+    //Loads the bar and runs the simulation.
+    if (!loadFile.empty()){
+        bool loaded = parallelLoad ? bar.loadFileParallel(loadFile, threads) : bar.loadFile(loadFile);
+        if (!loaded) return 1;
+    }
+    if (!loadSnapshot.empty() && !bar.loadSnapshot(loadSnapshot)) return 1;
+    if (!journal.empty() && !bar.openJournal(journal, journalSync)) return 1;
+    if (!updatePrices.empty() && !bar.updatePrices(updatePrices)) return 1;
+    if (!saveSnapshot.empty() && !bar.saveSnapshot(saveSnapshot)) return 1;
+    if (settings.numOrders > 0 && replicas > 0){
+        MonteCarloStats stats = bar.runMonteCarlo(settings, replicas, threads);
+        if (stats.replicas == 0){
+            cout << "Error: Too few recipes to simulate." << endl;
+            return 1;
+        }
+
+        cout << stats.print();
+    } else if (settings.numOrders > 0){
+        SimulationStats stats = bar.runSimulation(settings);
+        if (stats.orders == 0 && stats.bankruptAt == -1){
+            cout << "Error: Too few recipes to simulate." << endl;
+            return 1;
+        }
+
+        cout << stats.print();
+    }
+
+    return 0;
+}
+
 /**
  * Main point of entry for the
  * program. Invokes the sandwich
  * bar class.
+ * @param argc The number of arguments.
+ * @param argv The arguments.
  * @return Program return code.
  */
-int main() {
+int main(int argc, char** argv) {
+    //Runs without prompting if told what to do.
+    if (argc > 1) return runHeadless(argc, argv);
+
     //Prepare sandwich bar.
     SandwichBar bar = SandwichBar();
 
@@ -27,4 +228,4 @@ int main() {
     bar.handleCommands();
 
     return 0;
-}
\ No newline at end of file
+}